@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace railway {
+
+// Lock-free single-producer/single-consumer ring buffer over caller-provided storage.
+// push() and pop() never allocate or block, so the producer side is safe to call from a
+// control loop or an ISR. When the ring is full push() drops the item and counts it.
+// `capacity` must be a power of two; one producer and one consumer thread at most.
+template <typename T>
+class SpscRing {
+public:
+    SpscRing(T* storage, std::size_t capacity) : storage_(storage), mask_(capacity - 1) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Producer side.
+    bool push(const T& item) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail > mask_) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        storage_[head & mask_] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side.
+    bool pop(T& item) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        item = storage_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pops up to `max` items into `out`; returns how many were copied.
+    std::size_t popMany(T* out, std::size_t max) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        std::size_t n = head - tail;
+        if (n > max) {
+            n = max;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = storage_[(tail + i) & mask_];
+        }
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    std::size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    std::size_t capacity() const {
+        return mask_ + 1;
+    }
+
+    // Number of items rejected because the ring was full.
+    std::size_t dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    T* storage_;
+    std::size_t mask_;
+
+    // Producer and consumer indices live on separate cache lines.
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    std::atomic<std::size_t> dropped_{0};
+};
+
+namespace detail {
+
+template <typename T, std::size_t N>
+struct RingStorage {
+    std::array<T, N> slots_{};
+};
+
+} // namespace detail
+
+// SpscRing that owns its storage.
+template <typename T, std::size_t N>
+class StaticSpscRing : private detail::RingStorage<T, N>, public SpscRing<T> {
+    static_assert(N != 0 && (N & (N - 1)) == 0, "capacity must be a power of two");
+
+public:
+    StaticSpscRing() : SpscRing<T>(this->slots_.data(), N) {}
+};
+
+} // namespace railway
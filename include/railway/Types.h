@@ -5,6 +5,17 @@
 namespace railway {
 
 using Millis = std::uint32_t;
+// 64-bit monotonic microseconds; does not wrap within any realistic uptime.
+using Micros = std::uint64_t;
+
+// Wrap-safe ordering of two Millis timestamps that are less than ~24.8 days apart.
+constexpr bool isBefore(Millis a, Millis b) {
+    return static_cast<std::int32_t>(a - b) < 0;
+}
+
+constexpr Millis earliest(Millis a, Millis b) {
+    return isBefore(b, a) ? b : a;
+}
 
 enum class Health : std::uint8_t {
     Ok = 0,
@@ -4,37 +4,179 @@
 #include "railway/drivers/SignalHead.h"
 #include "railway/drivers/TrackCircuitInput.h"
 #include "railway/hal/IClock.h"
+#include "railway/hal/IGpio.h"
+#include "railway/hal/PinSnapshot.h"
+#include "railway/logic/ControllerLogic.h"
 #include "railway/logic/Interlocking.h"
 
 namespace railway::app {
 
+struct BlockControllerConfig {
+    railway::Millis maxLoopGapMs{200};
+    // When non-zero, the loop-gap check uses IClock::nowUs() against this budget instead of
+    // maxLoopGapMs, for loops that must be held to sub-millisecond gaps.
+    railway::Micros maxLoopGapUs{0};
+};
+
 // Mixed hardware + logic controller for a single block.
-class BlockController {
+//
+// `Gpio` and `Clock` are the HAL bindings. With concrete backends (e.g. PlatformGpio and
+// PlatformClock) the whole tick is resolved at compile time; BlockController binds to the
+// virtual IGpio/IClock interfaces.
+//
+// `OwnTrack` and `DownstreamTrack` are the occupancy sources. Any type with the track circuit
+// surface (init, update(now), isOccupied, isHealthy, isEventDriven, nextDeadlineMs,
+// forwardEdges and a kUsesPinSnapshot constant) fits, e.g. BasicAxleCounterSection. Sources
+// with kUsesPinSnapshot also provide pin(), gpio() and update(now, snapshot).
+template <typename Gpio,
+          typename Clock,
+          typename OwnTrack = railway::drivers::BasicTrackCircuitInput<Gpio>,
+          typename DownstreamTrack = OwnTrack>
+class BasicBlockController {
 public:
-    struct Config {
-        railway::Millis maxLoopGapMs{200};
-    };
+    using Config = BlockControllerConfig;
+    using TrackCircuit = OwnTrack;
+    using DownstreamTrackCircuit = DownstreamTrack;
+    using Signal = railway::drivers::BasicSignalHead<Gpio>;
 
-    BlockController(const Config& cfg,
-                    railway::hal::IClock& clock,
-                    railway::drivers::TrackCircuitInput& ownTrack,
-                    railway::drivers::TrackCircuitInput& downstreamTrack,
-                    railway::drivers::SignalHead& signal);
+    BasicBlockController(const Config& cfg,
+                         Clock& clock,
+                         TrackCircuit& ownTrack,
+                         DownstreamTrackCircuit& downstreamTrack,
+                         Signal& signal);
 
     void init();
     void tick();
 
     railway::logic::Decision lastDecision() const;
 
+    // Time the next tick() is due: the earliest track circuit deadline, or half the loop gap
+    // after the last tick. The watchdog deadline sits well inside the gap so that a sleeper
+    // waking late still ticks while the controller counts as fresh. Input edges are not
+    // included; see inputsEventDriven().
+    railway::Millis nextDeadlineMs() const;
+
+    // True when both track circuits run event-driven, i.e. input changes are reported as
+    // edges and a caller may sleep until nextDeadlineMs() or an edge.
+    bool inputsEventDriven() const;
+
+    // Forwards input edges of both track circuits to `listener` (event-driven mode only).
+    void wakeOnInputEdges(railway::hal::IEdgeListener* listener);
+
 private:
     Config cfg_{};
-    railway::hal::IClock& clock_;
-    railway::drivers::TrackCircuitInput& ownTrack_;
-    railway::drivers::TrackCircuitInput& downstreamTrack_;
-    railway::drivers::SignalHead& signal_;
+    Clock& clock_;
+    TrackCircuit& ownTrack_;
+    DownstreamTrackCircuit& downstreamTrack_;
+    Signal& signal_;
+
+    // Both track circuits are sampled from one snapshot per tick when they share a GPIO backend.
+    static constexpr bool kSnapshotInputs = OwnTrack::kUsesPinSnapshot && DownstreamTrack::kUsesPinSnapshot;
+    railway::hal::PinSnapshot inputs_{};
+    bool sampleInputs_{false};
 
     railway::Millis lastTickMs_{0};
+    railway::Micros lastTickUs_{0};
     railway::logic::Decision last_{};
 };
 
+using BlockController = BasicBlockController<railway::hal::IGpio, railway::hal::IClock>;
+
+template <typename Gpio, typename Clock, typename OwnTrack, typename DownstreamTrack>
+BasicBlockController<Gpio, Clock, OwnTrack, DownstreamTrack>::BasicBlockController(const Config& cfg,
+                                                                          Clock& clock,
+                                                                          TrackCircuit& ownTrack,
+                                                                          DownstreamTrackCircuit& downstreamTrack,
+                                                                          Signal& signal)
+    : cfg_(cfg),
+      clock_(clock),
+      ownTrack_(ownTrack),
+      downstreamTrack_(downstreamTrack),
+      signal_(signal) {}
+
+template <typename Gpio, typename Clock, typename OwnTrack, typename DownstreamTrack>
+void BasicBlockController<Gpio, Clock, OwnTrack, DownstreamTrack>::init() {
+    ownTrack_.init();
+    downstreamTrack_.init();
+    signal_.init();
+
+    inputs_.clear();
+    if constexpr (kSnapshotInputs) {
+        sampleInputs_ = (&ownTrack_.gpio() == &downstreamTrack_.gpio()) &&
+                        inputs_.watch(ownTrack_.pin()) && inputs_.watch(downstreamTrack_.pin());
+    }
+
+    lastTickMs_ = clock_.nowMs();
+    lastTickUs_ = (cfg_.maxLoopGapUs != 0) ? clock_.nowUs() : 0;
+    last_ = railway::logic::evaluate(railway::logic::Inputs{});
+    signal_.setAspect(last_.aspect);
+}
+
+template <typename Gpio, typename Clock, typename OwnTrack, typename DownstreamTrack>
+void BasicBlockController<Gpio, Clock, OwnTrack, DownstreamTrack>::tick() {
+    const auto now = clock_.nowMs();
+
+    bool sampled = false;
+    if constexpr (kSnapshotInputs) {
+        if (sampleInputs_) {
+            inputs_.capture(ownTrack_.gpio());
+            ownTrack_.update(now, inputs_);
+            downstreamTrack_.update(now, inputs_);
+            sampled = true;
+        }
+    }
+    if (!sampled) {
+        ownTrack_.update(now);
+        downstreamTrack_.update(now);
+    }
+
+    if (cfg_.maxLoopGapUs != 0) {
+        const auto nowUs = clock_.nowUs();
+        last_ = railway::logic::evaluateControllerLogicUs(lastTickUs_, nowUs, cfg_.maxLoopGapUs,
+                                                           ownTrack_.isHealthy(), ownTrack_.isOccupied(), downstreamTrack_.isOccupied());
+        lastTickUs_ = nowUs;
+    } else {
+        last_ = railway::logic::evaluateControllerLogic(lastTickMs_, now, cfg_.maxLoopGapMs,
+                                                         ownTrack_.isHealthy(), ownTrack_.isOccupied(), downstreamTrack_.isOccupied());
+    }
+    lastTickMs_ = now;
+    // Proves the aspect shown since the last tick; a lamp fault holds the signal at Stop.
+    last_ = railway::logic::applyLampProving(last_, signal_.verifyLamps());
+    signal_.setAspect(last_.aspect);
+}
+
+template <typename Gpio, typename Clock, typename OwnTrack, typename DownstreamTrack>
+railway::logic::Decision BasicBlockController<Gpio, Clock, OwnTrack, DownstreamTrack>::lastDecision() const {
+    return last_;
+}
+
+template <typename Gpio, typename Clock, typename OwnTrack, typename DownstreamTrack>
+railway::Millis BasicBlockController<Gpio, Clock, OwnTrack, DownstreamTrack>::nextDeadlineMs() const {
+    railway::Millis deadline = (cfg_.maxLoopGapUs != 0)
+                                   ? static_cast<railway::Millis>((lastTickUs_ + cfg_.maxLoopGapUs / 2U) / 1000U)
+                                   : lastTickMs_ + cfg_.maxLoopGapMs / 2U;
+    railway::Millis trackDeadline = 0;
+    if (ownTrack_.nextDeadlineMs(trackDeadline)) {
+        deadline = railway::earliest(deadline, trackDeadline);
+    }
+    if (downstreamTrack_.nextDeadlineMs(trackDeadline)) {
+        deadline = railway::earliest(deadline, trackDeadline);
+    }
+    return deadline;
+}
+
+template <typename Gpio, typename Clock, typename OwnTrack, typename DownstreamTrack>
+bool BasicBlockController<Gpio, Clock, OwnTrack, DownstreamTrack>::inputsEventDriven() const {
+    return ownTrack_.isEventDriven() && downstreamTrack_.isEventDriven();
+}
+
+template <typename Gpio, typename Clock, typename OwnTrack, typename DownstreamTrack>
+void BasicBlockController<Gpio, Clock, OwnTrack, DownstreamTrack>::wakeOnInputEdges(railway::hal::IEdgeListener* listener) {
+    ownTrack_.forwardEdges(listener);
+    downstreamTrack_.forwardEdges(listener);
+}
+
+// The virtual binding is compiled once in BlockController.cpp.
+extern template class BasicBlockController<railway::hal::IGpio, railway::hal::IClock>;
+
 } // namespace railway::app
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "railway/hal/MockGpio.h"
+
+#include <cstdint>
+
+namespace railway::app {
+
+// Demo layout shared by the real-time host demo and the virtual-time runner.
+constexpr railway::hal::Pin kDemoOwnTrackPin = 2;
+constexpr railway::hal::Pin kDemoDownstreamTrackPin = 3;
+constexpr railway::hal::Pin kDemoRedPin = 10;
+constexpr railway::hal::Pin kDemoYellowPin = 11;
+constexpr railway::hal::Pin kDemoGreenPin = 12;
+
+// Length of one pass through the scenario timeline; it repeats after this.
+constexpr std::uint64_t kDemoScenarioPeriodMs = 4000;
+
+// Scenario timeline:
+// - 0ms: both clear
+// - 600ms: downstream becomes occupied -> CAUTION
+// - 1300ms: own becomes occupied -> STOP
+// - 1900ms: own clears again -> CAUTION
+// - 2500ms: downstream clears -> CLEAR
+// - 3000ms+: induce a track circuit "fault" by holding own not-clear long enough
+
+// Applies the input changes scheduled at 0ms. Call once before the first tick.
+void startDemoScenario(railway::hal::MockGpio& mock);
+
+// Applies, in timeline order, every input change scheduled in (afterMs, throughMs] of scenario
+// time, repeating the timeline every kDemoScenarioPeriodMs. Runners pass the previous and the
+// current tick time, so no change is missed whatever the tick length. Spans longer than one
+// period are cut to their last period.
+void applyDemoScenario(railway::hal::MockGpio& mock, std::uint64_t afterMs, std::uint64_t throughMs);
+
+} // namespace railway::app
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "railway/Types.h"
+#include "railway/hal/IClock.h"
+#include "railway/hal/IGpio.h"
+#include "railway/hal/ISleeper.h"
+
+#include <cstdint>
+
+namespace railway::app {
+
+struct TicklessRunnerConfig {
+    // Never tick more often than this; also the sample period for integrating debounce.
+    railway::Millis minPeriodMs{5};
+    // Sampling period used when the inputs cannot report edges (polling mode).
+    railway::Millis pollPeriodMs{50};
+    // Upper bound on any single sleep.
+    railway::Millis maxSleepMs{1000};
+};
+
+// Drives a block controller without a fixed tick: after each tick it sleeps until the
+// controller's next deadline, or until an input edge wakes it.
+//
+// `Controller` is any BasicBlockController instantiation.
+template <typename Controller>
+class TicklessRunner {
+public:
+    using Config = TicklessRunnerConfig;
+
+    TicklessRunner(const Config& cfg, Controller& controller, const railway::hal::IClock& clock,
+                   railway::hal::ISleeper& sleeper)
+        : cfg_(cfg), controller_(controller), clock_(clock), waker_(sleeper) {}
+
+    ~TicklessRunner() {
+        controller_.wakeOnInputEdges(nullptr);
+    }
+
+    TicklessRunner(const TicklessRunner&) = delete;
+    TicklessRunner& operator=(const TicklessRunner&) = delete;
+
+    // Call after controller.init().
+    void init() {
+        controller_.wakeOnInputEdges(&waker_);
+    }
+
+    // One tick followed by one sleep. Returns the deadline that was slept towards.
+    railway::Millis runOnce() {
+        controller_.tick();
+        ++ticks_;
+
+        const railway::Millis now = clock_.nowMs();
+        railway::Millis deadline = railway::earliest(controller_.nextDeadlineMs(), now + cfg_.maxSleepMs);
+        if (!controller_.inputsEventDriven()) {
+            deadline = railway::earliest(deadline, now + cfg_.pollPeriodMs);
+        }
+        if (railway::isBefore(deadline, now + cfg_.minPeriodMs)) {
+            deadline = now + cfg_.minPeriodMs;
+        }
+        waker_.sleeper.sleepUntilMs(deadline);
+        return deadline;
+    }
+
+    std::uint32_t ticks() const {
+        return ticks_;
+    }
+
+private:
+    struct Waker final : public railway::hal::IEdgeListener {
+        explicit Waker(railway::hal::ISleeper& s) : sleeper(s) {}
+        void onEdge(const railway::hal::EdgeEvent& event) override {
+            (void)event;
+            sleeper.wake();
+        }
+        railway::hal::ISleeper& sleeper;
+    };
+
+    Config cfg_{};
+    Controller& controller_;
+    const railway::hal::IClock& clock_;
+    Waker waker_;
+    std::uint32_t ticks_{0};
+};
+
+} // namespace railway::app
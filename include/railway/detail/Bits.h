@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Bitmap helpers shared by the packed-state drivers (TrackCircuitBank, SignalBank,
+// FlashScheduler). Internal: not part of the public API.
+namespace railway::detail {
+
+// Element i of a packed bitmap is bit (i % kBitsPerWord) of word (i / kBitsPerWord).
+constexpr std::size_t kBitsPerWord = 64;
+
+constexpr std::uint64_t bitOf(std::size_t index) {
+    return std::uint64_t{1} << (index % kBitsPerWord);
+}
+
+// Index of the lowest set bit; `bits` must not be zero.
+inline std::size_t lowestSetBit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+    std::size_t n = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+} // namespace railway::detail
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "railway/Types.h"
+#include "railway/hal/IAdc.h"
+#include "railway/hal/IGpio.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+// Defaults suit a 12-bit converter reading the relay voltage through a divider.
+struct AnalogTrackCircuitConfig {
+    railway::hal::AdcChannel channel{0};
+    // Hysteresis on the filtered level, in ADC counts: the circuit turns clear once the level
+    // reaches clearAboveCounts and occupied once it drops to occupiedBelowCounts.
+    std::uint16_t clearAboveCounts{2600};
+    std::uint16_t occupiedBelowCounts{1800};
+    // An averaged level at or above this is a feed fault (e.g. relay bypassed or shorted to
+    // supply): unhealthy and occupied, since it can no longer be shunted by a train.
+    std::uint16_t overRangeCounts{4000};
+    // log2 of the raw samples averaged into one filter input (capped at 8).
+    std::uint8_t decimationShift{4};
+    // Single-pole low-pass on the averaged level: y += (x - y) / 2^filterShift (capped at 15).
+    std::uint8_t filterShift{3};
+    railway::Millis stuckLowFaultMs{3000};
+    // No samples for this long means the converter stopped: unhealthy and occupied.
+    railway::Millis sampleTimeoutMs{100};
+};
+
+// Sums `count` samples. Kept free of loop-carried state beyond the accumulators so the
+// compiler can vectorize it; this is where the per-sample work of the analog input goes.
+std::uint32_t sumAdcSamples(const railway::hal::AdcSample* samples, std::size_t count);
+
+// Track circuit input read from an analog relay-voltage signal instead of a digital pin.
+//
+// Samples are taken from the ADC in blocks. Each block is averaged in groups of
+// 2^decimationShift samples (the vectorizable part), and each group average feeds a
+// fixed-point single-pole low-pass with hysteresis thresholds, so the per-sample cost is an
+// add and no floating point is used. Starts occupied until the first group average is in.
+//
+// Health: unhealthy when the level stays occupied beyond stuckLowFaultMs (as for the digital
+// input), when the level is over range, or when no samples arrive within sampleTimeoutMs.
+// Unhealthy always reads as occupied.
+//
+// Exposes the track circuit surface used by BasicBlockController; it has no pin and polls, so
+// it is never event-driven.
+template <typename Adc>
+class BasicAnalogTrackCircuitInput {
+public:
+    using Config = AnalogTrackCircuitConfig;
+
+    static constexpr bool kUsesPinSnapshot = false;
+
+    BasicAnalogTrackCircuitInput(const Config& cfg, Adc& adc);
+
+    void init();
+    void update(railway::Millis nowMs);
+
+    bool isOccupied() const;
+    bool isHealthy() const;
+
+    // Filtered relay level in ADC counts (truncated).
+    std::uint16_t filteredCounts() const;
+
+    bool isEventDriven() const;
+    // Earliest of the stuck-low fault and the sample timeout. Samples themselves are only seen
+    // by polling, so callers must also bound their sleep by a sampling period.
+    bool nextDeadlineMs(railway::Millis& deadlineMs) const;
+    // No edges to forward; present for BasicBlockController.
+    void forwardEdges(railway::hal::IEdgeListener* listener);
+
+private:
+    static constexpr std::size_t kBlock = 64;
+    // Filter state carries 8 fractional bits.
+    static constexpr unsigned kFractionBits = 8;
+
+    void consume(const railway::hal::AdcSample* samples, std::size_t count);
+    void filter(std::uint32_t groupSum);
+    unsigned decimationShift() const;
+    unsigned filterShift() const;
+
+    Config cfg_{};
+    Adc& adc_;
+
+    bool started_{false};
+    bool primed_{false};
+    // Low-pass output in counts << kFractionBits.
+    std::int32_t level_{0};
+    // Partial decimation group carried between blocks.
+    std::uint32_t groupSum_{0};
+    std::uint32_t groupFill_{0};
+
+    bool clear_{false};
+    bool overRange_{false};
+    bool stalled_{false};
+    bool stuckLow_{false};
+    bool stuckLowArmed_{false};
+    railway::Millis stuckLowSinceMs_{0};
+    bool timing_{false};
+    railway::Millis lastSampleMs_{0};
+};
+
+using AnalogTrackCircuitInput = BasicAnalogTrackCircuitInput<railway::hal::IAdc>;
+
+template <typename Adc>
+BasicAnalogTrackCircuitInput<Adc>::BasicAnalogTrackCircuitInput(const Config& cfg, Adc& adc)
+    : cfg_(cfg), adc_(adc) {}
+
+template <typename Adc>
+void BasicAnalogTrackCircuitInput<Adc>::init() {
+    started_ = adc_.start(cfg_.channel);
+    // Stale samples from before init() say nothing about the track now.
+    railway::hal::AdcSample discard[kBlock];
+    while (started_ && adc_.read(cfg_.channel, discard, kBlock) != 0) {
+    }
+    primed_ = false;
+    level_ = 0;
+    groupSum_ = 0;
+    groupFill_ = 0;
+    clear_ = false;
+    overRange_ = false;
+    stalled_ = false;
+    stuckLow_ = false;
+    stuckLowArmed_ = false;
+    stuckLowSinceMs_ = 0;
+    timing_ = false;
+    lastSampleMs_ = 0;
+}
+
+template <typename Adc>
+void BasicAnalogTrackCircuitInput<Adc>::update(railway::Millis nowMs) {
+    if (!started_) {
+        return;
+    }
+    if (!timing_) {
+        // The sample timeout runs from the first update().
+        timing_ = true;
+        lastSampleMs_ = nowMs;
+    }
+
+    railway::hal::AdcSample block[kBlock];
+    bool gotSamples = false;
+    for (;;) {
+        const std::size_t n = adc_.read(cfg_.channel, block, kBlock);
+        if (n == 0) {
+            break;
+        }
+        consume(block, n);
+        gotSamples = true;
+        if (n < kBlock) {
+            break;
+        }
+    }
+
+    if (gotSamples) {
+        lastSampleMs_ = nowMs;
+        stalled_ = false;
+    } else if ((nowMs - lastSampleMs_) >= cfg_.sampleTimeoutMs) {
+        stalled_ = true;
+    }
+
+    if (!clear_) {
+        if (!stuckLowArmed_) {
+            stuckLowArmed_ = true;
+            stuckLowSinceMs_ = nowMs;
+        }
+        stuckLow_ = (nowMs - stuckLowSinceMs_) >= cfg_.stuckLowFaultMs;
+    } else {
+        stuckLowArmed_ = false;
+        stuckLow_ = false;
+    }
+}
+
+template <typename Adc>
+void BasicAnalogTrackCircuitInput<Adc>::consume(const railway::hal::AdcSample* samples, std::size_t count) {
+    const unsigned shift = decimationShift();
+    const std::uint32_t groupSize = std::uint32_t{1} << shift;
+    std::size_t i = 0;
+
+    // Finish the group left over from the previous block.
+    if (groupFill_ != 0) {
+        std::size_t take = groupSize - groupFill_;
+        if (take > count) {
+            take = count;
+        }
+        groupSum_ += sumAdcSamples(samples, take);
+        groupFill_ += static_cast<std::uint32_t>(take);
+        i = take;
+        if (groupFill_ < groupSize) {
+            return;
+        }
+        filter(groupSum_);
+        groupSum_ = 0;
+        groupFill_ = 0;
+    }
+
+    for (; i + groupSize <= count; i += groupSize) {
+        filter(sumAdcSamples(samples + i, groupSize));
+    }
+
+    if (i < count) {
+        groupSum_ = sumAdcSamples(samples + i, count - i);
+        groupFill_ = static_cast<std::uint32_t>(count - i);
+    }
+}
+
+template <typename Adc>
+void BasicAnalogTrackCircuitInput<Adc>::filter(std::uint32_t groupSum) {
+    const std::uint32_t average = groupSum >> decimationShift();
+    overRange_ = average >= cfg_.overRangeCounts;
+
+    const std::int32_t input = static_cast<std::int32_t>(average << kFractionBits);
+    if (!primed_) {
+        level_ = input;
+        primed_ = true;
+    } else {
+        // Arithmetic shift: rounds toward -inf, which settles within one count of the input.
+        level_ += (input - level_) >> filterShift();
+    }
+
+    const std::uint32_t counts = static_cast<std::uint32_t>(level_) >> kFractionBits;
+    if (clear_) {
+        clear_ = counts > cfg_.occupiedBelowCounts;
+    } else {
+        clear_ = counts >= cfg_.clearAboveCounts;
+    }
+}
+
+template <typename Adc>
+unsigned BasicAnalogTrackCircuitInput<Adc>::decimationShift() const {
+    // 2^8 samples of 16 bits still fit the 32-bit group sum.
+    return (cfg_.decimationShift > 8) ? 8U : cfg_.decimationShift;
+}
+
+template <typename Adc>
+unsigned BasicAnalogTrackCircuitInput<Adc>::filterShift() const {
+    return (cfg_.filterShift > 15) ? 15U : cfg_.filterShift;
+}
+
+template <typename Adc>
+bool BasicAnalogTrackCircuitInput<Adc>::isOccupied() const {
+    return !clear_ || !isHealthy();
+}
+
+template <typename Adc>
+bool BasicAnalogTrackCircuitInput<Adc>::isHealthy() const {
+    return started_ && !overRange_ && !stalled_ && !stuckLow_;
+}
+
+template <typename Adc>
+std::uint16_t BasicAnalogTrackCircuitInput<Adc>::filteredCounts() const {
+    return static_cast<std::uint16_t>(static_cast<std::uint32_t>(level_) >> kFractionBits);
+}
+
+template <typename Adc>
+bool BasicAnalogTrackCircuitInput<Adc>::isEventDriven() const {
+    return false;
+}
+
+template <typename Adc>
+bool BasicAnalogTrackCircuitInput<Adc>::nextDeadlineMs(railway::Millis& deadlineMs) const {
+    if (!started_ || !timing_) {
+        return false;
+    }
+    railway::Millis deadline = lastSampleMs_ + cfg_.sampleTimeoutMs;
+    if (stuckLowArmed_ && !stuckLow_) {
+        deadline = railway::earliest(deadline, stuckLowSinceMs_ + cfg_.stuckLowFaultMs);
+    }
+    deadlineMs = deadline;
+    return true;
+}
+
+template <typename Adc>
+void BasicAnalogTrackCircuitInput<Adc>::forwardEdges(railway::hal::IEdgeListener* /*listener*/) {}
+
+extern template class BasicAnalogTrackCircuitInput<railway::hal::IAdc>;
+
+} // namespace railway::drivers
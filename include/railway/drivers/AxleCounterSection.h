@@ -0,0 +1,435 @@
+#pragma once
+
+#include "railway/SpscRing.h"
+#include "railway/Types.h"
+#include "railway/hal/IGpio.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+// The four wheel sensors of a section: one double-sensor counting head at each end. At both
+// heads sensor A is the outer one, so a wheel entering the section passes A before B.
+enum class AxleSensor : std::uint8_t {
+    Head0A = 0,
+    Head0B = 1,
+    Head1A = 2,
+    Head1B = 3,
+};
+
+// One wheel-sensor edge as captured in interrupt context.
+struct AxlePulse {
+    AxleSensor sensor{AxleSensor::Head0A};
+    // True when the wheel arrived over the sensor, false when it left.
+    bool wheelPresent{false};
+    railway::Millis atMs{0};
+};
+
+// Filled by the section's edge listener (producer, interrupt context), drained by update()
+// (consumer). Size it for the longest burst between two ticks: a full ring drops pulses and
+// the section goes unhealthy, it never guesses the missing counts.
+using AxlePulseRing = railway::SpscRing<AxlePulse>;
+
+template <std::size_t N>
+using StaticAxlePulseRing = railway::StaticSpscRing<AxlePulse, N>;
+
+enum class AxleDirection : std::uint8_t {
+    None = 0,
+    // The axles now in the section entered over head 0.
+    Head0ToHead1 = 1,
+    Head1ToHead0 = 2,
+};
+
+enum class AxleCounterFault : std::uint8_t {
+    None = 0,
+    // Counts are unknown (after init() with requireResetOnInit) until reset().
+    Disturbed = 1,
+    // The pulse ring was full and pulses were lost.
+    Overflow = 2,
+    // A sensor reported the level it already had, i.e. an edge was missed.
+    SensorSequence = 3,
+    // More axles left than entered.
+    CountUnderflow = 4,
+    // The backend cannot report edges on a sensor pin; pulses cannot be captured.
+    NoEdgeSupport = 5,
+};
+
+struct AxleCounterConfig {
+    railway::hal::Pin head0A{0};
+    railway::hal::Pin head0B{1};
+    railway::hal::Pin head1A{2};
+    railway::hal::Pin head1B{3};
+    // Sensor output is Low while a wheel is over it.
+    bool activeLow{true};
+    // Start disturbed: the section reports occupied and unhealthy until reset(), because
+    // axles may have moved while the counter was not running.
+    bool requireResetOnInit{true};
+    // Upper bound on pulses decoded per update(); 0 drains the ring. Pulses beyond the bound
+    // stay queued for the next update() and are reported by nextDeadlineMs().
+    std::size_t maxPulsesPerUpdate{0};
+};
+
+// Axle-counter occupancy for one section.
+//
+// Each counting head is decoded like a quadrature encoder: a wheel crossing A then B walks
+// the head through 00 -> A -> AB -> B -> 00, the reverse order walks it backwards, and one
+// axle is counted when the head returns to 00 after a full walk in either direction. Wheels
+// that rock on a head without crossing it count nothing. The section is occupied while
+// axles in != axles out.
+//
+// Sensor edges are pushed into an AxlePulseRing from the backend's edge context and decoded
+// in batches by update(), so the per-edge work in interrupt context is one ring push. All
+// four sensors must report edges from the same context (one ISR priority / core), since the
+// ring has a single producer.
+//
+// Exposes the same occupancy surface as BasicTrackCircuitInput, so it can stand in for a
+// track circuit in BasicBlockController. When unhealthy it reports occupied.
+template <typename Gpio>
+class BasicAxleCounterSection {
+public:
+    using Config = AxleCounterConfig;
+
+    // Occupancy comes from the pulse ring, not from a pin level; see BasicBlockController.
+    static constexpr bool kUsesPinSnapshot = false;
+
+    BasicAxleCounterSection(const Config& cfg, Gpio& gpio, AxlePulseRing& pulses);
+    ~BasicAxleCounterSection();
+
+    // Registered with the backend as an edge listener; must stay at a fixed address.
+    BasicAxleCounterSection(const BasicAxleCounterSection&) = delete;
+    BasicAxleCounterSection& operator=(const BasicAxleCounterSection&) = delete;
+
+    void init();
+    void update(railway::Millis nowMs);
+
+    // Supervised reset after the section has been verified empty: zeroes the counts, drops
+    // queued pulses and clears the fault.
+    void reset();
+
+    bool isOccupied() const;
+    bool isHealthy() const;
+    AxleCounterFault fault() const;
+
+    // Totals since the last reset(), over both heads.
+    std::uint32_t axlesIn() const;
+    std::uint32_t axlesOut() const;
+    // Axles currently in the section (axlesIn - axlesOut while healthy).
+    std::uint32_t axleCount() const;
+    AxleDirection direction() const;
+    // update() time of the last counted axle.
+    railway::Millis lastAxleMs() const;
+
+    // True when all four sensor pins report edges. Without edges the section stays
+    // unhealthy (NoEdgeSupport): polling cannot keep up with wheel pulses.
+    bool isEventDriven() const;
+
+    // Pulses still queued are due immediately; otherwise only a new pulse can change state.
+    bool nextDeadlineMs(railway::Millis& deadlineMs) const;
+
+    // Also passes every sensor edge to `listener` (e.g. to wake a sleeping runner). Called in
+    // the backend's edge context. Pass nullptr to stop.
+    void forwardEdges(railway::hal::IEdgeListener* listener);
+
+private:
+    class PulseCapture final : public railway::hal::IEdgeListener {
+    public:
+        explicit PulseCapture(BasicAxleCounterSection& owner) : owner_(owner) {}
+        void onEdge(const railway::hal::EdgeEvent& event) override {
+            owner_.capture(event);
+        }
+
+    private:
+        BasicAxleCounterSection& owner_;
+    };
+
+    // Quadrature state of one counting head.
+    struct Head {
+        // Position in the inbound walk 00 -> A -> AB -> B (0..3).
+        std::uint8_t position{0};
+        // Quarter steps since the head last stood at 00; +4 / -4 complete one axle.
+        std::int8_t phase{0};
+        bool a{false};
+        bool b{false};
+    };
+
+    static constexpr std::size_t kBatch = 32;
+
+    void capture(const railway::hal::EdgeEvent& event);
+    void decode(const AxlePulse& pulse, railway::Millis nowMs);
+    void countAxle(std::size_t head, bool inbound, railway::Millis nowMs);
+    void setFault(AxleCounterFault fault);
+    void clearHeads();
+    bool wheelPresent(railway::hal::PinLevel level) const;
+
+    Config cfg_{};
+    Gpio& gpio_;
+    AxlePulseRing& pulses_;
+    PulseCapture capture_{*this};
+    std::atomic<railway::hal::IEdgeListener*> forward_{nullptr};
+
+    Head heads_[2]{};
+    std::uint32_t axlesIn_{0};
+    std::uint32_t axlesOut_{0};
+    AxleDirection direction_{AxleDirection::None};
+    railway::Millis lastAxleMs_{0};
+    railway::Millis lastUpdateMs_{0};
+
+    AxleCounterFault fault_{AxleCounterFault::None};
+    std::size_t droppedSeen_{0};
+    // Bit i set when sensor i (AxleSensor order) is subscribed to edges.
+    std::uint8_t subscribedMask_{0};
+};
+
+using AxleCounterSection = BasicAxleCounterSection<railway::hal::IGpio>;
+
+template <typename Gpio>
+BasicAxleCounterSection<Gpio>::BasicAxleCounterSection(const Config& cfg, Gpio& gpio, AxlePulseRing& pulses)
+    : cfg_(cfg), gpio_(gpio), pulses_(pulses) {}
+
+template <typename Gpio>
+BasicAxleCounterSection<Gpio>::~BasicAxleCounterSection() {
+    const railway::hal::Pin pins[4] = {cfg_.head0A, cfg_.head0B, cfg_.head1A, cfg_.head1B};
+    for (std::size_t i = 0; i < 4; ++i) {
+        if ((subscribedMask_ & (1U << i)) != 0) {
+            gpio_.unsubscribeEdges(pins[i]);
+        }
+    }
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::init() {
+    const railway::hal::Pin pins[4] = {cfg_.head0A, cfg_.head0B, cfg_.head1A, cfg_.head1B};
+    for (std::size_t i = 0; i < 4; ++i) {
+        gpio_.configure(pins[i], railway::hal::PinMode::InputPullup);
+        if (gpio_.subscribeEdges(pins[i], railway::hal::Edge::Both, capture_)) {
+            subscribedMask_ = static_cast<std::uint8_t>(subscribedMask_ | (1U << i));
+        }
+    }
+
+    fault_ = AxleCounterFault::None;
+    reset();
+    if (!isEventDriven()) {
+        setFault(AxleCounterFault::NoEdgeSupport);
+    } else if (cfg_.requireResetOnInit) {
+        setFault(AxleCounterFault::Disturbed);
+    }
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::reset() {
+    AxlePulse discard[kBatch];
+    while (pulses_.popMany(discard, kBatch) != 0) {
+    }
+    droppedSeen_ = pulses_.dropped();
+
+    clearHeads();
+    axlesIn_ = 0;
+    axlesOut_ = 0;
+    direction_ = AxleDirection::None;
+    lastAxleMs_ = 0;
+    if (fault_ != AxleCounterFault::NoEdgeSupport) {
+        fault_ = AxleCounterFault::None;
+    }
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::clearHeads() {
+    // Seed the heads from the current sensor levels so a wheel standing on a sensor is not
+    // mistaken for a missed edge. Its walk then cannot end on a whole axle; decode() treats
+    // that as Disturbed rather than guessing.
+    heads_[0] = Head{};
+    heads_[1] = Head{};
+    heads_[0].a = wheelPresent(gpio_.read(cfg_.head0A));
+    heads_[0].b = wheelPresent(gpio_.read(cfg_.head0B));
+    heads_[1].a = wheelPresent(gpio_.read(cfg_.head1A));
+    heads_[1].b = wheelPresent(gpio_.read(cfg_.head1B));
+    for (Head& head : heads_) {
+        // 00 -> 0, A -> 1, AB -> 2, B -> 3.
+        head.position = static_cast<std::uint8_t>(head.a ? (head.b ? 2 : 1) : (head.b ? 3 : 0));
+    }
+}
+
+template <typename Gpio>
+bool BasicAxleCounterSection<Gpio>::wheelPresent(railway::hal::PinLevel level) const {
+    return (level == railway::hal::PinLevel::Low) == cfg_.activeLow;
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::capture(const railway::hal::EdgeEvent& event) {
+    AxlePulse pulse;
+    if (event.pin == cfg_.head0A) {
+        pulse.sensor = AxleSensor::Head0A;
+    } else if (event.pin == cfg_.head0B) {
+        pulse.sensor = AxleSensor::Head0B;
+    } else if (event.pin == cfg_.head1A) {
+        pulse.sensor = AxleSensor::Head1A;
+    } else {
+        pulse.sensor = AxleSensor::Head1B;
+    }
+    pulse.wheelPresent = (event.edge == railway::hal::Edge::Falling) == cfg_.activeLow;
+    pulse.atMs = event.atMs;
+    pulses_.push(pulse);
+
+    railway::hal::IEdgeListener* forward = forward_.load(std::memory_order_acquire);
+    if (forward != nullptr) {
+        forward->onEdge(event);
+    }
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::update(railway::Millis nowMs) {
+    lastUpdateMs_ = nowMs;
+
+    const std::size_t limit = cfg_.maxPulsesPerUpdate;
+    std::size_t decoded = 0;
+    AxlePulse batch[kBatch];
+    for (;;) {
+        std::size_t want = kBatch;
+        if (limit != 0 && limit - decoded < want) {
+            want = limit - decoded;
+        }
+        const std::size_t n = (want != 0) ? pulses_.popMany(batch, want) : 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            decode(batch[i], nowMs);
+        }
+        decoded += n;
+        if (n < kBatch) {
+            break;
+        }
+    }
+
+    // Checked after draining so the pulses that did fit are still accounted for.
+    const std::size_t dropped = pulses_.dropped();
+    if (dropped != droppedSeen_) {
+        droppedSeen_ = dropped;
+        setFault(AxleCounterFault::Overflow);
+    }
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::decode(const AxlePulse& pulse, railway::Millis nowMs) {
+    const std::size_t index = static_cast<std::size_t>(pulse.sensor) / 2;
+    Head& head = heads_[index];
+    bool& level = ((static_cast<std::uint8_t>(pulse.sensor) & 1U) == 0) ? head.a : head.b;
+    if (level == pulse.wheelPresent) {
+        // The opposite edge never arrived, so the walk position is unknown.
+        head.phase = 0;
+        setFault(AxleCounterFault::SensorSequence);
+        return;
+    }
+    level = pulse.wheelPresent;
+
+    // One sensor changes per pulse, so the walk moves exactly one quarter step.
+    const std::uint8_t position = static_cast<std::uint8_t>(head.a ? (head.b ? 2 : 1) : (head.b ? 3 : 0));
+    if (position == ((head.position + 1) & 3U)) {
+        ++head.phase;
+    } else {
+        --head.phase;
+    }
+    head.position = position;
+
+    if (position == 0) {
+        if (head.phase == 4) {
+            countAxle(index, true, nowMs);
+        } else if (head.phase == -4) {
+            countAxle(index, false, nowMs);
+        } else if (head.phase != 0) {
+            // Only a walk that started off 00 (a wheel standing on the head at reset) can end
+            // here; whether that axle crossed is unknown.
+            setFault(AxleCounterFault::Disturbed);
+        }
+        head.phase = 0;
+    }
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::countAxle(std::size_t head, bool inbound, railway::Millis nowMs) {
+    lastAxleMs_ = nowMs;
+    if (inbound) {
+        if (axlesIn_ == axlesOut_) {
+            direction_ = (head == 0) ? AxleDirection::Head0ToHead1 : AxleDirection::Head1ToHead0;
+        }
+        ++axlesIn_;
+        return;
+    }
+    ++axlesOut_;
+    if (axlesOut_ > axlesIn_) {
+        setFault(AxleCounterFault::CountUnderflow);
+    }
+    if (axlesOut_ == axlesIn_) {
+        direction_ = AxleDirection::None;
+    }
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::setFault(AxleCounterFault fault) {
+    // The first fault is kept; it is the one maintenance needs to see.
+    if (fault_ == AxleCounterFault::None) {
+        fault_ = fault;
+    }
+}
+
+template <typename Gpio>
+bool BasicAxleCounterSection<Gpio>::isOccupied() const {
+    return !isHealthy() || axlesIn_ != axlesOut_;
+}
+
+template <typename Gpio>
+bool BasicAxleCounterSection<Gpio>::isHealthy() const {
+    return fault_ == AxleCounterFault::None;
+}
+
+template <typename Gpio>
+AxleCounterFault BasicAxleCounterSection<Gpio>::fault() const {
+    return fault_;
+}
+
+template <typename Gpio>
+std::uint32_t BasicAxleCounterSection<Gpio>::axlesIn() const {
+    return axlesIn_;
+}
+
+template <typename Gpio>
+std::uint32_t BasicAxleCounterSection<Gpio>::axlesOut() const {
+    return axlesOut_;
+}
+
+template <typename Gpio>
+std::uint32_t BasicAxleCounterSection<Gpio>::axleCount() const {
+    return (axlesIn_ > axlesOut_) ? axlesIn_ - axlesOut_ : 0;
+}
+
+template <typename Gpio>
+AxleDirection BasicAxleCounterSection<Gpio>::direction() const {
+    return direction_;
+}
+
+template <typename Gpio>
+railway::Millis BasicAxleCounterSection<Gpio>::lastAxleMs() const {
+    return lastAxleMs_;
+}
+
+template <typename Gpio>
+bool BasicAxleCounterSection<Gpio>::isEventDriven() const {
+    return subscribedMask_ == 0x0F;
+}
+
+template <typename Gpio>
+bool BasicAxleCounterSection<Gpio>::nextDeadlineMs(railway::Millis& deadlineMs) const {
+    if (pulses_.empty()) {
+        return false;
+    }
+    deadlineMs = lastUpdateMs_;
+    return true;
+}
+
+template <typename Gpio>
+void BasicAxleCounterSection<Gpio>::forwardEdges(railway::hal::IEdgeListener* listener) {
+    forward_.store(listener, std::memory_order_release);
+}
+
+extern template class BasicAxleCounterSection<railway::hal::IGpio>;
+
+} // namespace railway::drivers
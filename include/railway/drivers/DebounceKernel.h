@@ -0,0 +1,48 @@
+#pragma once
+
+#include "railway/Types.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+// One timer-mode (DebounceMode::Timer) TrackCircuitInput per lane, stored as parallel arrays of `count` elements. Flags are
+// 32-bit lanes holding 0 or 1 so they line up with the timestamps in vector registers.
+struct DebounceLanes {
+    // Input: this tick's raw "clear" sample per circuit (already corrected for activeLow).
+    const std::uint32_t* newRawClear;
+    // Per-circuit configuration.
+    const railway::Millis* debounceMs;
+    const railway::Millis* stuckLowFaultMs;
+    // State, same meaning as the TrackCircuitInput fields of the same name.
+    std::uint32_t* rawClear;
+    std::uint32_t* stableClear;
+    std::uint32_t* healthy;
+    railway::Millis* lastRawChangeMs;
+    railway::Millis* stuckLowSinceMs;
+};
+
+enum class DebounceKernel : std::uint8_t {
+    Scalar = 0,
+    Avx2 = 1,
+    Neon = 2,
+};
+
+// Equivalent of TrackCircuitInput::init() on every lane, taking the initial sample from
+// newRawClear.
+void initDebounceLanes(const DebounceLanes& lanes, std::size_t count);
+
+// Equivalent of TrackCircuitInput::update(nowMs) on every lane, bit-exact including the
+// zero-timestamp stuck-low sentinel and millis wrap. Uses the fastest kernel the CPU supports.
+void updateDebounceLanes(const DebounceLanes& lanes, std::size_t count, railway::Millis nowMs);
+
+// Runs a specific kernel; one the CPU cannot execute falls back to Scalar. Mainly for tests.
+void updateDebounceLanes(const DebounceLanes& lanes, std::size_t count, railway::Millis nowMs,
+                         DebounceKernel kernel);
+
+// Kernel picked by updateDebounceLanes() on this CPU, and whether `kernel` can run here.
+DebounceKernel bestDebounceKernel();
+bool debounceKernelSupported(DebounceKernel kernel);
+
+} // namespace railway::drivers
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "railway/Types.h"
+#include "railway/detail/Bits.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+// Something with flashing lamps, driven by a FlashScheduler.
+class IFlashTarget {
+public:
+    virtual ~IFlashTarget() = default;
+    // Called on every flash phase change while the target is marked flashing.
+    virtual void onFlashPhase(bool lit) = 0;
+};
+
+// One flash timer shared by every flashing head, so all of them flash in phase and none needs
+// its own timer.
+//
+// The first update() anchors the phase to absolute time (lit during even half-periods), so
+// controllers with synchronised clocks flash in phase too. After that the phase advances by
+// whole half-periods from the last change, which keeps the rhythm steady across the 32-bit
+// millisecond wrap. update() must run at least every ~24 days (the range of the wrap-safe
+// comparison). Targets mark themselves flashing in a packed bitmap;
+// a phase change costs one pass over that bitmap, calling only the flashing targets.
+//
+// Target i is bit (i % 64) of word (i / 64); storage is laid out as in TrackCircuitBank, with
+// StaticFlashScheduler as the owning wrapper.
+class FlashScheduler {
+public:
+    static constexpr std::size_t kBitsPerWord = railway::detail::kBitsPerWord;
+
+    static constexpr std::size_t wordsFor(std::size_t targets) {
+        return (targets + kBitsPerWord - 1) / kBitsPerWord;
+    }
+
+    // `targets` holds `capacity` elements, `flashing` wordsFor(capacity) words.
+    struct Arrays {
+        IFlashTarget** targets;
+        std::uint64_t* flashing;
+    };
+
+    // A zero half-period is treated as 1 ms.
+    FlashScheduler(const Arrays& arrays, std::size_t capacity, railway::Millis halfPeriodMs);
+
+    FlashScheduler(const FlashScheduler&) = delete;
+    FlashScheduler& operator=(const FlashScheduler&) = delete;
+
+    // Registers `target` in a free slot. Returns false when the scheduler is full.
+    bool attach(IFlashTarget& target, std::size_t& slot);
+    void detach(std::size_t slot);
+
+    void setFlashing(std::size_t slot, bool flashing);
+    bool isFlashing(std::size_t slot) const;
+
+    // Phase as of the last update().
+    bool phaseLit() const;
+
+    // Recomputes the phase for `nowMs`. On a change, calls onFlashPhase() on every flashing
+    // target in slot order and returns true.
+    bool update(railway::Millis nowMs);
+
+    // Time of the next phase change after the last update(); always a whole number of
+    // half-periods after the previous one.
+    railway::Millis nextChangeMs() const;
+
+    railway::Millis halfPeriodMs() const;
+    std::size_t capacity() const;
+
+private:
+    Arrays a_;
+    std::size_t capacity_;
+    std::size_t words_;
+    railway::Millis halfPeriodMs_;
+    bool lit_{true};
+    bool started_{false};
+    railway::Millis nextChangeMs_;
+};
+
+namespace detail {
+
+template <std::size_t N>
+struct FlashSchedulerArrays {
+    std::array<IFlashTarget*, N> targets_{};
+    std::array<std::uint64_t, FlashScheduler::wordsFor(N)> flashing_{};
+
+    FlashScheduler::Arrays view() {
+        return {targets_.data(), flashing_.data()};
+    }
+};
+
+} // namespace detail
+
+// FlashScheduler that owns storage for N targets.
+template <std::size_t N>
+class StaticFlashScheduler : private detail::FlashSchedulerArrays<N>, public FlashScheduler {
+    static_assert(N != 0, "scheduler needs at least one target");
+
+public:
+    explicit StaticFlashScheduler(railway::Millis halfPeriodMs) : FlashScheduler(this->view(), N, halfPeriodMs) {}
+};
+
+} // namespace railway::drivers
@@ -0,0 +1,291 @@
+#pragma once
+
+#include "railway/Types.h"
+#include "railway/drivers/FlashScheduler.h"
+#include "railway/drivers/SignalHead.h"
+#include "railway/drivers/SignalHeadType.h"
+#include "railway/hal/IGpio.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+struct MultiAspectSignalHeadConfig {
+    static constexpr std::size_t kMaxLamps = 8;
+    static constexpr std::size_t kMaxConflicts = 8;
+
+    std::array<railway::hal::Pin, kMaxLamps> lampPins{};
+    std::uint8_t lampCount{0};
+    bool activeHigh{true};
+    // Indexed by Aspect. Aspects with an empty pattern are not shown by this head and fall
+    // back to Stop, so Stop needs a steady pattern.
+    std::array<LampPattern, kAspectCount> patterns{};
+    // Lamp sets (bit i = lamp i) that no pattern may light together; zero entries are unused.
+    std::array<std::uint8_t, kMaxConflicts> conflicts{};
+};
+
+// Four-aspect head with lamps red, yellow, green, second yellow (the usual colour-light
+// arrangement): Stop, Caution, Clear, DoubleCaution and both flashing cautions. Patterns and
+// conflicts are FourAspectHead's, checked at compile time.
+MultiAspectSignalHeadConfig fourAspectHeadConfig(railway::hal::Pin redPin,
+                                                 railway::hal::Pin yellowPin,
+                                                 railway::hal::Pin greenPin,
+                                                 railway::hal::Pin secondYellowPin,
+                                                 bool activeHigh = true);
+
+// Signal head with configurable lamps and per-aspect lamp patterns, including flashing ones.
+//
+// The configuration is runtime data, so the constructor checks it with lampPatternsAreSafe().
+// A head whose configuration fails shows only Stop, and stays dark if Stop itself is not a safe
+// steady pattern; configValid() reports the failure.
+//
+// Flashing is driven by a shared FlashScheduler: the head marks itself flashing while it shows
+// a flashing aspect and the scheduler calls back on every phase change. Without a scheduler,
+// flashing lamps are shown steady.
+//
+// Lamp patterns are precomputed into per-port masked writes as in SignalHead. When the lamps
+// span several ports, every lamp that goes dark is written before any lamp that lights, so a
+// change never shows the union of two patterns.
+template <typename Gpio>
+class BasicMultiAspectSignalHead final : public IFlashTarget {
+public:
+    using Config = MultiAspectSignalHeadConfig;
+
+    BasicMultiAspectSignalHead(const Config& cfg, Gpio& gpio);
+    ~BasicMultiAspectSignalHead() override;
+
+    // Registered with a FlashScheduler; must stay at a fixed address.
+    BasicMultiAspectSignalHead(const BasicMultiAspectSignalHead&) = delete;
+    BasicMultiAspectSignalHead& operator=(const BasicMultiAspectSignalHead&) = delete;
+
+    // Takes a slot in `scheduler` (nullptr detaches). Returns false when it is full; the head
+    // then shows flashing lamps steady.
+    bool attachFlashScheduler(FlashScheduler* scheduler);
+
+    void init();
+    void setAspect(Aspect aspect);
+    Aspect currentAspect() const;
+
+    // True when `aspect` has a pattern on this head.
+    bool supports(Aspect aspect) const;
+
+    // False when the configuration was rejected at construction.
+    bool configValid() const;
+
+    void onFlashPhase(bool lit) override;
+
+private:
+    static constexpr std::size_t kMaxGroups = Config::kMaxLamps;
+
+    // Lamps sharing a port. Values are port levels per aspect, already adjusted for polarity:
+    // `lit` with the flashing lamps on, `dark` with them off.
+    struct LampGroup {
+        railway::hal::Port port{0};
+        railway::hal::PortMask mask{0};
+        std::array<railway::hal::PortMask, kAspectCount> lit{};
+        std::array<railway::hal::PortMask, kAspectCount> dark{};
+        // Last written levels.
+        railway::hal::PortMask image{0};
+    };
+
+    void computeLampMasks();
+    bool flashes() const;
+    void show();
+
+    Config cfg_{};
+    Gpio& gpio_;
+    bool configValid_{false};
+    Aspect aspect_{Aspect::Stop};
+    bool flashLit_{true};
+
+    FlashScheduler* scheduler_{nullptr};
+    std::size_t slot_{0};
+
+    std::array<LampGroup, kMaxGroups> groups_{};
+    std::size_t groupCount_{0};
+    // Level at which lamp bits are lit: all ones for activeHigh heads, zero otherwise.
+    railway::hal::PortMask litHigh_{0};
+};
+
+using MultiAspectSignalHead = BasicMultiAspectSignalHead<railway::hal::IGpio>;
+
+template <typename Gpio>
+BasicMultiAspectSignalHead<Gpio>::BasicMultiAspectSignalHead(const Config& cfg, Gpio& gpio) : cfg_(cfg), gpio_(gpio) {
+    if (cfg_.lampCount > Config::kMaxLamps) {
+        cfg_.lampCount = Config::kMaxLamps;
+    }
+    configValid_ = lampPatternsAreSafe(cfg_.lampCount, cfg_.patterns, cfg_.conflicts);
+    if (!configValid_) {
+        // Keep only Stop, and only if it is safe by itself.
+        const LampPattern stop = cfg_.patterns[static_cast<std::size_t>(Aspect::Stop)];
+        cfg_.patterns = {};
+        cfg_.patterns[static_cast<std::size_t>(Aspect::Stop)] = stop;
+        if (!lampPatternsAreSafe(cfg_.lampCount, cfg_.patterns, cfg_.conflicts)) {
+            cfg_.patterns = {};
+        }
+    }
+    computeLampMasks();
+}
+
+template <typename Gpio>
+BasicMultiAspectSignalHead<Gpio>::~BasicMultiAspectSignalHead() {
+    attachFlashScheduler(nullptr);
+}
+
+template <typename Gpio>
+bool BasicMultiAspectSignalHead<Gpio>::attachFlashScheduler(FlashScheduler* scheduler) {
+    if (scheduler_ != nullptr) {
+        scheduler_->detach(slot_);
+        scheduler_ = nullptr;
+    }
+    if (scheduler == nullptr) {
+        return true;
+    }
+    if (!scheduler->attach(*this, slot_)) {
+        return false;
+    }
+    scheduler_ = scheduler;
+    scheduler_->setFlashing(slot_, flashes());
+    flashLit_ = scheduler_->phaseLit();
+    return true;
+}
+
+template <typename Gpio>
+void BasicMultiAspectSignalHead<Gpio>::init() {
+    for (std::size_t lamp = 0; lamp < cfg_.lampCount; ++lamp) {
+        gpio_.configure(cfg_.lampPins[lamp], railway::hal::PinMode::OutputPushPull);
+    }
+
+    computeLampMasks();
+    // The pins' current levels are unknown: drive every lamp dark, then show Stop.
+    for (std::size_t g = 0; g < groupCount_; ++g) {
+        groups_[g].image = groups_[g].mask & ~litHigh_;
+        gpio_.writeMasked(groups_[g].port, groups_[g].mask, groups_[g].image);
+    }
+    setAspect(Aspect::Stop);
+}
+
+template <typename Gpio>
+void BasicMultiAspectSignalHead<Gpio>::computeLampMasks() {
+    groupCount_ = 0;
+    litHigh_ = cfg_.activeHigh ? ~railway::hal::PortMask{0} : 0;
+    for (std::size_t lamp = 0; lamp < cfg_.lampCount; ++lamp) {
+        const auto port = railway::hal::portOf(cfg_.lampPins[lamp]);
+        const auto bit = railway::hal::maskOf(cfg_.lampPins[lamp]);
+
+        std::size_t g = 0;
+        while (g < groupCount_ && groups_[g].port != port) {
+            ++g;
+        }
+        if (g == groupCount_) {
+            groups_[g] = LampGroup{port, 0, {}, {}, 0};
+            ++groupCount_;
+        }
+        groups_[g].mask |= bit;
+
+        const auto lampBit = static_cast<std::uint8_t>(1U << lamp);
+        for (std::size_t a = 0; a < kAspectCount; ++a) {
+            const LampPattern& pattern = cfg_.patterns[a];
+            if (((pattern.steady | pattern.flashing) & lampBit) != 0) {
+                groups_[g].lit[a] |= bit;
+            }
+            if ((pattern.steady & lampBit) != 0) {
+                groups_[g].dark[a] |= bit;
+            }
+        }
+    }
+
+    // Both arrays hold lit bits so far; lit lamps are Low on activeLow heads.
+    if (!cfg_.activeHigh) {
+        for (std::size_t g = 0; g < groupCount_; ++g) {
+            for (std::size_t a = 0; a < kAspectCount; ++a) {
+                groups_[g].lit[a] = groups_[g].mask & ~groups_[g].lit[a];
+                groups_[g].dark[a] = groups_[g].mask & ~groups_[g].dark[a];
+            }
+        }
+    }
+}
+
+template <typename Gpio>
+bool BasicMultiAspectSignalHead<Gpio>::supports(Aspect aspect) const {
+    const auto index = static_cast<std::size_t>(aspect);
+    if (index >= kAspectCount) {
+        return false;
+    }
+    const LampPattern& pattern = cfg_.patterns[index];
+    return (pattern.steady | pattern.flashing) != 0;
+}
+
+template <typename Gpio>
+bool BasicMultiAspectSignalHead<Gpio>::configValid() const {
+    return configValid_;
+}
+
+template <typename Gpio>
+void BasicMultiAspectSignalHead<Gpio>::setAspect(Aspect aspect) {
+    // Fail-safe: unknown values and aspects without a pattern on this head become STOP.
+    if (!supports(aspect)) {
+        aspect = Aspect::Stop;
+    }
+    aspect_ = aspect;
+    if (scheduler_ != nullptr) {
+        scheduler_->setFlashing(slot_, flashes());
+        flashLit_ = scheduler_->phaseLit();
+    }
+    show();
+}
+
+template <typename Gpio>
+Aspect BasicMultiAspectSignalHead<Gpio>::currentAspect() const {
+    return aspect_;
+}
+
+template <typename Gpio>
+bool BasicMultiAspectSignalHead<Gpio>::flashes() const {
+    return cfg_.patterns[static_cast<std::size_t>(aspect_)].flashing != 0;
+}
+
+template <typename Gpio>
+void BasicMultiAspectSignalHead<Gpio>::onFlashPhase(bool lit) {
+    flashLit_ = lit;
+    show();
+}
+
+template <typename Gpio>
+void BasicMultiAspectSignalHead<Gpio>::show() {
+    const auto index = static_cast<std::size_t>(aspect_);
+    // Flashing lamps are steady without a scheduler.
+    const bool flashLit = (scheduler_ == nullptr) || flashLit_;
+
+    if (groupCount_ == 1) {
+        LampGroup& group = groups_[0];
+        const railway::hal::PortMask target = flashLit ? group.lit[index] : group.dark[index];
+        if (target != group.image) {
+            gpio_.writeMasked(group.port, group.mask, target);
+            group.image = target;
+        }
+        return;
+    }
+
+    // Pass 1 turns lamps off, pass 2 turns lamps on.
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t g = 0; g < groupCount_; ++g) {
+            LampGroup& group = groups_[g];
+            const railway::hal::PortMask target = flashLit ? group.lit[index] : group.dark[index];
+            const railway::hal::PortMask changed = group.image ^ target;
+            const railway::hal::PortMask litBits = ~(target ^ litHigh_) & group.mask;
+            const railway::hal::PortMask mask = changed & ((pass == 0) ? ~litBits : litBits);
+            if (mask != 0) {
+                gpio_.writeMasked(group.port, mask, target & mask);
+                group.image = (group.image & ~mask) | (target & mask);
+            }
+        }
+    }
+}
+
+// The virtual binding is compiled once in MultiAspectSignalHead.cpp.
+extern template class BasicMultiAspectSignalHead<railway::hal::IGpio>;
+
+} // namespace railway::drivers
@@ -0,0 +1,271 @@
+#pragma once
+
+#include "railway/detail/Bits.h"
+#include "railway/drivers/SignalHead.h"
+#include "railway/drivers/SignalHeadType.h"
+#include "railway/hal/IGpio.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+// Output stage for many signal heads, with the lamp semantics of SignalHead: each aspect
+// lights exactly one lamp and unknown aspects become Stop.
+//
+// Aspects are held in a packed array and setAspect() only records the change. flush() then
+// turns the heads changed since the last flush into per-port masked writes: the per-head,
+// per-aspect port values are precomputed by configure(), and all heads sharing a port are
+// merged into one write. A quiet tick costs nothing beyond scanning the dirty bitmap.
+//
+// Never two lamps lit: a head whose lamps share one port changes in a single masked write,
+// as in SignalHead. A head spread over several ports is switched in two passes, every lamp
+// that goes dark before any lamp that lights. Ports touched by such heads may therefore get
+// two writes per flush; all others get one.
+//
+// Lamp proving: heads configured with proving inputs are checked by verify(), which reads
+// every port carrying proving inputs once (readPort) and compares each head's share with the
+// levels its flushed aspect should produce. As in SignalHead, a head faults after
+// provingMismatchLimit consecutive failed checks and stays faulted until clearLampFault().
+// A faulted head is forced to Stop: verify() stages Stop for the next flush() and setAspect()
+// accepts nothing else.
+//
+// Head i is bit (i % 64) of word (i / 64) of the head bitmaps; storage is laid out as in
+// TrackCircuitBank, with StaticSignalBank as the owning wrapper.
+class SignalBank {
+public:
+    static constexpr std::size_t kBitsPerWord = railway::detail::kBitsPerWord;
+    static constexpr std::size_t kLampsPerHead = ThreeAspectHead::kLampCount;
+    // Aspects a three-lamp head shows; the others resolve to Stop.
+    static constexpr std::size_t kAspectCount = 3;
+
+    static constexpr std::size_t wordsFor(std::size_t bits) {
+        return (bits + kBitsPerWord - 1) / kBitsPerWord;
+    }
+
+    // One port's share of a head: lamp bits and their levels for every aspect.
+    struct LampGroup {
+        std::uint16_t slot{0};
+        railway::hal::PortMask mask{0};
+        std::array<railway::hal::PortMask, kAspectCount> values{};
+    };
+
+    struct HeadLamps {
+        std::array<LampGroup, kLampsPerHead> groups{};
+        std::uint8_t groupCount{0};
+        // Proving inputs, with the levels expected for every aspect.
+        std::array<LampGroup, kLampsPerHead> proveGroups{};
+        std::uint8_t proveGroupCount{0};
+        std::uint8_t mismatchLimit{1};
+        std::uint8_t mismatches{0};
+    };
+
+    // Output state of one port used by the bank.
+    struct PortState {
+        railway::hal::Port port{0};
+        // Lamp bits owned by the bank on this port.
+        railway::hal::PortMask mask{0};
+        // Lamp bits lit at the High level.
+        railway::hal::PortMask activeHigh{0};
+        // Commanded levels of the owned bits.
+        railway::hal::PortMask image{0};
+        // Bits waiting for flush(): changes of single-port heads, and lamps of multi-port
+        // heads that go dark / light.
+        railway::hal::PortMask pendingAtomic{0};
+        railway::hal::PortMask pendingOff{0};
+        railway::hal::PortMask pendingOn{0};
+        // Proving input bits on this port and their levels at the last verify().
+        railway::hal::PortMask proveMask{0};
+        railway::hal::PortMask proveLevels{0};
+    };
+
+    // Head arrays hold `capacity` elements (bitmaps wordsFor(capacity) words), port arrays
+    // `portCapacity` elements (portDirty wordsFor(portCapacity) words).
+    struct Arrays {
+        std::uint8_t* aspects;
+        std::uint64_t* dirty;
+        std::uint64_t* present;
+        std::uint64_t* proving;
+        std::uint64_t* lampFaults;
+        HeadLamps* lamps;
+        PortState* ports;
+        std::uint64_t* portDirty;
+    };
+
+    SignalBank(const Arrays& arrays, std::size_t capacity, std::size_t portCapacity);
+
+    SignalBank(const SignalBank&) = delete;
+    SignalBank& operator=(const SignalBank&) = delete;
+
+    // Sets up head `index` from a SignalHead config, including its proving inputs. Returns
+    // false if `index` is out of range, the head is already configured, a lamp or proving pin
+    // is already used by the bank or the bank has no port slot left.
+    bool configure(std::size_t index, const SignalHeadConfig& cfg);
+
+    // Configures every lamp pin as an output and every proving pin as an input, drives every
+    // lamp dark and then all heads to Stop. Clears lamp faults.
+    template <typename Gpio>
+    void init(Gpio& gpio);
+
+    // Records the aspect; nothing is written until flush(). Ignored for unconfigured heads;
+    // heads with a lamp fault record Stop.
+    void setAspect(std::size_t index, Aspect aspect);
+    Aspect aspect(std::size_t index) const;
+
+    // Writes the changes since the last flush(). Returns the number of masked port writes.
+    template <typename Gpio>
+    std::size_t flush(Gpio& gpio);
+
+    // Checks the proving inputs of every proving head against its aspect, with one readPort()
+    // per port carrying proving inputs. Call after flush(); heads changed since the last
+    // flush() are skipped. Returns true when no head has a lamp fault.
+    template <typename Gpio>
+    bool verify(Gpio& gpio);
+
+    // True unless head `index` has a latched lamp fault; heads without proving always prove.
+    bool lampsProven(std::size_t index) const;
+    // Maintainer reset after the lamp fault of head `index` has been repaired.
+    void clearLampFault(std::size_t index);
+    std::size_t lampFaultCount() const;
+
+    std::size_t capacity() const;
+    std::size_t portCount() const;
+
+private:
+    // Moves the dirty heads into the pending masks of their ports.
+    void stage();
+    void stageHead(std::size_t index);
+    void proveHead(std::size_t index);
+    void clearPending(PortState& port);
+
+    Arrays a_;
+    std::size_t capacity_;
+    std::size_t words_;
+    std::size_t portCapacity_;
+    std::size_t portWords_;
+    std::size_t portCount_{0};
+};
+
+template <typename Gpio>
+void SignalBank::init(Gpio& gpio) {
+    for (std::size_t s = 0; s < portCount_; ++s) {
+        PortState& port = a_.ports[s];
+        for (std::size_t bit = 0; bit < railway::hal::kPinsPerPort; ++bit) {
+            const railway::hal::PortMask b = railway::hal::PortMask{1} << bit;
+            if ((port.mask & b) != 0) {
+                gpio.configure(railway::hal::pinOf(port.port, bit), railway::hal::PinMode::OutputPushPull);
+            } else if ((port.proveMask & b) != 0) {
+                gpio.configure(railway::hal::pinOf(port.port, bit), railway::hal::PinMode::Input);
+            }
+        }
+    }
+    // The pins' current levels are unknown: drive every lamp dark, then show Stop.
+    for (std::size_t s = 0; s < portCount_; ++s) {
+        PortState& port = a_.ports[s];
+        port.image = port.mask & ~port.activeHigh;
+        clearPending(port);
+        if (port.mask != 0) {
+            gpio.writeMasked(port.port, port.mask, port.image);
+        }
+    }
+    for (std::size_t w = 0; w < portWords_; ++w) {
+        a_.portDirty[w] = 0;
+    }
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        a_.aspects[i] = static_cast<std::uint8_t>(Aspect::Stop);
+    }
+    for (std::size_t w = 0; w < words_; ++w) {
+        a_.dirty[w] = a_.present[w];
+        a_.lampFaults[w] = 0;
+    }
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        a_.lamps[i].mismatches = 0;
+    }
+    flush(gpio);
+}
+
+template <typename Gpio>
+std::size_t SignalBank::flush(Gpio& gpio) {
+    stage();
+
+    std::size_t writes = 0;
+    // Pass 1: single-port heads switch atomically; lamps of multi-port heads go dark.
+    for (std::size_t w = 0; w < portWords_; ++w) {
+        for (std::uint64_t bits = a_.portDirty[w]; bits != 0; bits &= bits - 1) {
+            PortState& port = a_.ports[w * kBitsPerWord + railway::detail::lowestSetBit(bits)];
+            const railway::hal::PortMask mask = port.pendingAtomic | port.pendingOff;
+            if (mask != 0) {
+                gpio.writeMasked(port.port, mask, port.image & mask);
+                ++writes;
+            }
+        }
+    }
+    // Pass 2: lamps of multi-port heads light.
+    for (std::size_t w = 0; w < portWords_; ++w) {
+        for (std::uint64_t bits = a_.portDirty[w]; bits != 0; bits &= bits - 1) {
+            PortState& port = a_.ports[w * kBitsPerWord + railway::detail::lowestSetBit(bits)];
+            if (port.pendingOn != 0) {
+                gpio.writeMasked(port.port, port.pendingOn, port.image & port.pendingOn);
+                ++writes;
+            }
+            clearPending(port);
+        }
+        a_.portDirty[w] = 0;
+    }
+    return writes;
+}
+
+template <typename Gpio>
+bool SignalBank::verify(Gpio& gpio) {
+    for (std::size_t s = 0; s < portCount_; ++s) {
+        PortState& port = a_.ports[s];
+        if (port.proveMask != 0) {
+            port.proveLevels = gpio.readPort(port.port, port.proveMask);
+        }
+    }
+
+    bool proven = true;
+    for (std::size_t w = 0; w < words_; ++w) {
+        for (std::uint64_t bits = a_.proving[w] & ~a_.dirty[w] & ~a_.lampFaults[w]; bits != 0; bits &= bits - 1) {
+            proveHead(w * kBitsPerWord + railway::detail::lowestSetBit(bits));
+        }
+        proven = proven && (a_.lampFaults[w] == 0);
+    }
+    return proven;
+}
+
+namespace detail {
+
+template <std::size_t Heads, std::size_t Ports>
+struct SignalBankArrays {
+    static constexpr std::size_t kWords = SignalBank::wordsFor(Heads);
+    static constexpr std::size_t kPortWords = SignalBank::wordsFor(Ports);
+
+    std::array<std::uint8_t, Heads> aspects_{};
+    std::array<std::uint64_t, kWords> dirty_{};
+    std::array<std::uint64_t, kWords> present_{};
+    std::array<std::uint64_t, kWords> proving_{};
+    std::array<std::uint64_t, kWords> lampFaults_{};
+    std::array<SignalBank::HeadLamps, Heads> lamps_{};
+    std::array<SignalBank::PortState, Ports> ports_{};
+    std::array<std::uint64_t, kPortWords> portDirty_{};
+
+    SignalBank::Arrays view() {
+        return {aspects_.data(), dirty_.data(), present_.data(), proving_.data(), lampFaults_.data(),
+                lamps_.data(), ports_.data(), portDirty_.data()};
+    }
+};
+
+} // namespace detail
+
+// SignalBank that owns storage for `Heads` heads spread over at most `Ports` ports.
+template <std::size_t Heads, std::size_t Ports>
+class StaticSignalBank : private detail::SignalBankArrays<Heads, Ports>, public SignalBank {
+    static_assert(Heads != 0 && Ports != 0, "bank needs at least one head and one port");
+
+public:
+    StaticSignalBank() : SignalBank(this->view(), Heads, Ports) {}
+};
+
+} // namespace railway::drivers
@@ -1,37 +1,205 @@
 #pragma once
 
 #include "railway/Types.h"
+#include "railway/drivers/SignalHeadType.h"
 #include "railway/hal/IGpio.h"
 
+#include <array>
+#include <cstddef>
+
 namespace railway::drivers {
 
-enum class Aspect : std::uint8_t {
-    Stop = 0,    // Red
-    Caution = 1, // Yellow
-    Clear = 2,   // Green
+struct SignalHeadConfig {
+    railway::hal::Pin redPin{0};
+    railway::hal::Pin yellowPin{0};
+    railway::hal::Pin greenPin{0};
+    bool activeHigh{true};
+
+    // Optional lamp proving: one readback input per lamp (current sense or auxiliary
+    // contact), active while the lamp is lit.
+    bool proving{false};
+    railway::hal::Pin redProvePin{0};
+    railway::hal::Pin yellowProvePin{0};
+    railway::hal::Pin greenProvePin{0};
+    bool provingActiveHigh{true};
+    // Consecutive failed checks before a lamp fault latches (0 is treated as 1). One check
+    // per tick gives the readback a tick to follow a new aspect.
+    std::uint8_t provingMismatchLimit{2};
 };
 
-class SignalHead {
+// Three-lamp head (ThreeAspectHead). Port levels for every aspect are built once from the head
+// type's constexpr tables, so setAspect() is a table lookup and one masked write per port.
+//
+// `Gpio` is the HAL binding (see BasicTrackCircuitInput); SignalHead binds to IGpio.
+template <typename Gpio>
+class BasicSignalHead {
 public:
-    struct Config {
-        railway::hal::Pin redPin{0};
-        railway::hal::Pin yellowPin{0};
-        railway::hal::Pin greenPin{0};
-        bool activeHigh{true};
-    };
+    using Config = SignalHeadConfig;
 
-    SignalHead(const Config& cfg, railway::hal::IGpio& gpio);
+    BasicSignalHead(const Config& cfg, Gpio& gpio);
 
     void init();
     void setAspect(Aspect aspect);
     Aspect currentAspect() const;
 
+    // Checks the proving inputs against the current aspect with one readPort() per port they
+    // occupy. A fault latches after provingMismatchLimit consecutive failed checks. Returns
+    // lampsProven(); always true without proving.
+    bool verifyLamps();
+    bool lampsProven() const;
+    // Maintainer reset after a lamp fault has been repaired.
+    void clearLampFault();
+
 private:
-    void writeLamp(railway::hal::Pin pin, bool on);
+    using HeadType = ThreeAspectHead;
+    using Tables = HeadTypeTables<HeadType>;
+    static constexpr std::size_t kLampCount = HeadType::kLampCount;
+
+    // Pins sharing a port are accessed with one masked call. `values` holds the port levels
+    // for each aspect (indexed by Aspect), already adjusted for polarity; aspects the head
+    // does not show hold the Stop levels.
+    struct LampGroup {
+        railway::hal::Port port{0};
+        railway::hal::PortMask mask{0};
+        std::array<railway::hal::PortMask, kAspectCount> values{};
+    };
+    using LampGroups = std::array<LampGroup, kLampCount>;
+
+    void computeLampMasks();
+    // Pin i takes bit i of `levels`.
+    static std::size_t groupPins(const std::array<railway::hal::Pin, kLampCount>& pins,
+                                 const LampLevelTable& levels,
+                                 LampGroups& groups);
 
     Config cfg_{};
-    railway::hal::IGpio& gpio_;
+    Gpio& gpio_;
     Aspect aspect_{Aspect::Stop};
+
+    LampGroups groups_{};
+    std::size_t groupCount_{0};
+
+    LampGroups proveGroups_{};
+    std::size_t proveGroupCount_{0};
+    std::uint8_t provingMismatches_{0};
+    bool lampFault_{false};
 };
 
+using SignalHead = BasicSignalHead<railway::hal::IGpio>;
+
+template <typename Gpio>
+BasicSignalHead<Gpio>::BasicSignalHead(const Config& cfg, Gpio& gpio) : cfg_(cfg), gpio_(gpio) {
+    computeLampMasks();
+}
+
+template <typename Gpio>
+void BasicSignalHead<Gpio>::init() {
+    gpio_.configure(cfg_.redPin, railway::hal::PinMode::OutputPushPull);
+    gpio_.configure(cfg_.yellowPin, railway::hal::PinMode::OutputPushPull);
+    gpio_.configure(cfg_.greenPin, railway::hal::PinMode::OutputPushPull);
+    if (cfg_.proving) {
+        gpio_.configure(cfg_.redProvePin, railway::hal::PinMode::Input);
+        gpio_.configure(cfg_.yellowProvePin, railway::hal::PinMode::Input);
+        gpio_.configure(cfg_.greenProvePin, railway::hal::PinMode::Input);
+    }
+
+    computeLampMasks();
+    provingMismatches_ = 0;
+    lampFault_ = false;
+    setAspect(Aspect::Stop);
+}
+
+template <typename Gpio>
+void BasicSignalHead<Gpio>::computeLampMasks() {
+    // Lamp order matches ThreeAspectHead: red, yellow, green.
+    groupCount_ = groupPins({cfg_.redPin, cfg_.yellowPin, cfg_.greenPin}, Tables::levels(cfg_.activeHigh), groups_);
+    proveGroupCount_ = cfg_.proving ? groupPins({cfg_.redProvePin, cfg_.yellowProvePin, cfg_.greenProvePin},
+                                                Tables::levels(cfg_.provingActiveHigh), proveGroups_)
+                                    : 0;
+}
+
+template <typename Gpio>
+std::size_t BasicSignalHead<Gpio>::groupPins(const std::array<railway::hal::Pin, kLampCount>& pins,
+                                             const LampLevelTable& levels,
+                                             LampGroups& groups) {
+    std::size_t count = 0;
+    for (std::size_t lamp = 0; lamp < kLampCount; ++lamp) {
+        const auto port = railway::hal::portOf(pins[lamp]);
+        const auto bit = railway::hal::maskOf(pins[lamp]);
+
+        std::size_t g = 0;
+        while (g < count && groups[g].port != port) {
+            ++g;
+        }
+        if (g == count) {
+            groups[g] = LampGroup{port, 0, {}};
+            ++count;
+        }
+        groups[g].mask |= bit;
+        for (std::size_t a = 0; a < kAspectCount; ++a) {
+            if (((levels[a] >> lamp) & 1U) != 0) {
+                groups[g].values[a] |= bit;
+            }
+        }
+    }
+    return count;
+}
+
+template <typename Gpio>
+void BasicSignalHead<Gpio>::setAspect(Aspect aspect) {
+    // Fail-safe: unknown values and aspects needing lamps this head lacks become STOP, by
+    // lookup rather than comparison.
+    const std::size_t index = Tables::shown(aspect);
+    aspect_ = static_cast<Aspect>(index);
+
+    // Never energize multiple lamps simultaneously (typical signalling requirement).
+    // ThreeAspectHead's patterns are checked for conflicting lamps at compile time; lamps on
+    // one port switch in a single write.
+    for (std::size_t g = 0; g < groupCount_; ++g) {
+        gpio_.writeMasked(groups_[g].port, groups_[g].mask, groups_[g].values[index]);
+    }
+}
+
+template <typename Gpio>
+Aspect BasicSignalHead<Gpio>::currentAspect() const {
+    return aspect_;
+}
+
+template <typename Gpio>
+bool BasicSignalHead<Gpio>::verifyLamps() {
+    if (proveGroupCount_ == 0 || lampFault_) {
+        return lampsProven();
+    }
+
+    const auto index = static_cast<std::size_t>(aspect_);
+    bool proven = true;
+    for (std::size_t g = 0; g < proveGroupCount_; ++g) {
+        const LampGroup& group = proveGroups_[g];
+        proven = proven && (gpio_.readPort(group.port, group.mask) == group.values[index]);
+    }
+
+    if (proven) {
+        provingMismatches_ = 0;
+    } else {
+        const std::uint8_t limit = (cfg_.provingMismatchLimit == 0) ? 1 : cfg_.provingMismatchLimit;
+        if (++provingMismatches_ >= limit) {
+            lampFault_ = true;
+        }
+    }
+    return lampsProven();
+}
+
+template <typename Gpio>
+bool BasicSignalHead<Gpio>::lampsProven() const {
+    return !lampFault_;
+}
+
+template <typename Gpio>
+void BasicSignalHead<Gpio>::clearLampFault() {
+    lampFault_ = false;
+    provingMismatches_ = 0;
+}
+
+// The virtual binding is compiled once in SignalHead.cpp.
+extern template class BasicSignalHead<railway::hal::IGpio>;
+
 } // namespace railway::drivers
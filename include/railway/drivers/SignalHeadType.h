@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+enum class Aspect : std::uint8_t {
+    Stop = 0,    // Red
+    Caution = 1, // Yellow
+    Clear = 2,   // Green
+    // Four-aspect and flashing aspects, shown by MultiAspectSignalHead. Three-lamp heads
+    // (SignalHead, SignalBank) do not have the lamps for them and show Stop instead.
+    DoubleCaution = 3,         // Two yellows
+    FlashingCaution = 4,       // Flashing yellow
+    FlashingDoubleCaution = 5, // Two flashing yellows
+};
+
+constexpr std::size_t kAspectCount = 6;
+
+constexpr bool isFlashing(Aspect aspect) {
+    return aspect == Aspect::FlashingCaution || aspect == Aspect::FlashingDoubleCaution;
+}
+
+// Lamps lit for one aspect; bit i refers to lamp i of the head.
+struct LampPattern {
+    std::uint8_t steady{0};
+    // Lit in the lit half of the flash phase, dark in the other.
+    std::uint8_t flashing{0};
+};
+
+// Compile-time description of a kind of signal head. A head type is a struct with
+//
+//   kLampCount  number of lamps (at most 8)
+//   kPatterns   std::array<LampPattern, kAspectCount>, indexed by Aspect; an empty pattern
+//               means the head does not show that aspect and shows Stop instead
+//   kConflicts  lamp sets (bit i = lamp i) that must never be lit together
+//
+// Pins are bound at runtime (SignalHeadConfig); everything that depends only on the head type
+// is turned into constexpr tables below and checked with headTypeIsSafe().
+
+// Three-lamp colour-light head: red, yellow, green, exactly one lit.
+struct ThreeAspectHead {
+    static constexpr std::size_t kLampCount = 3;
+    static constexpr std::uint8_t kRed = 1U << 0;
+    static constexpr std::uint8_t kYellow = 1U << 1;
+    static constexpr std::uint8_t kGreen = 1U << 2;
+
+    static constexpr std::array<LampPattern, kAspectCount> kPatterns{{
+        {kRed, 0},    // Stop
+        {kYellow, 0}, // Caution
+        {kGreen, 0},  // Clear
+        {},           // DoubleCaution
+        {},           // FlashingCaution
+        {},           // FlashingDoubleCaution
+    }};
+    static constexpr std::array<std::uint8_t, 3> kConflicts{kRed | kYellow, kRed | kGreen, kYellow | kGreen};
+};
+
+// Four-lamp head: red, yellow, green, second yellow (see fourAspectHeadConfig()).
+struct FourAspectHead {
+    static constexpr std::size_t kLampCount = 4;
+    static constexpr std::uint8_t kRed = 1U << 0;
+    static constexpr std::uint8_t kYellow = 1U << 1;
+    static constexpr std::uint8_t kGreen = 1U << 2;
+    static constexpr std::uint8_t kSecondYellow = 1U << 3;
+
+    static constexpr std::array<LampPattern, kAspectCount> kPatterns{{
+        {kRed, 0},                    // Stop
+        {kYellow, 0},                 // Caution
+        {kGreen, 0},                  // Clear
+        {kYellow | kSecondYellow, 0}, // DoubleCaution
+        {0, kYellow},                 // FlashingCaution
+        {0, kYellow | kSecondYellow}, // FlashingDoubleCaution
+    }};
+    // Red with any other lamp, green with either yellow.
+    static constexpr std::array<std::uint8_t, 5> kConflicts{
+        kRed | kYellow, kRed | kGreen, kRed | kSecondYellow, kGreen | kYellow, kGreen | kSecondYellow};
+};
+
+// Aspect index -> index of the aspect shown.
+using ShownAspectTable = std::array<std::uint8_t, kAspectCount>;
+// Aspect index -> lamp levels, bit i = lamp i driven High.
+using LampLevelTable = std::array<std::uint8_t, kAspectCount>;
+
+template <typename HeadType>
+constexpr std::uint8_t lampsOf(std::size_t aspect) {
+    return static_cast<std::uint8_t>(HeadType::kPatterns[aspect].steady | HeadType::kPatterns[aspect].flashing);
+}
+
+// True when Stop shows a steady pattern, every pattern stays within the first `lampCount` lamps
+// and no pattern (flashing lamps counted as lit) contains one of `conflicts`. Zero entries in
+// `conflicts` are unused.
+template <std::size_t N>
+constexpr bool lampPatternsAreSafe(std::size_t lampCount,
+                                   const std::array<LampPattern, kAspectCount>& patterns,
+                                   const std::array<std::uint8_t, N>& conflicts) {
+    if (lampCount == 0 || lampCount > 8) {
+        return false;
+    }
+    const unsigned lampMask = (1U << lampCount) - 1U;
+    const LampPattern& stop = patterns[static_cast<std::size_t>(Aspect::Stop)];
+    if (stop.steady == 0 || stop.flashing != 0) {
+        return false;
+    }
+    for (const LampPattern& pattern : patterns) {
+        const unsigned lit = pattern.steady | pattern.flashing;
+        if ((lit & ~lampMask) != 0) {
+            return false;
+        }
+        for (const std::uint8_t conflict : conflicts) {
+            if (conflict != 0 && (lit & conflict) == conflict) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename HeadType>
+constexpr bool headTypeIsSafe() {
+    return lampPatternsAreSafe(HeadType::kLampCount, HeadType::kPatterns, HeadType::kConflicts);
+}
+
+template <typename HeadType>
+constexpr ShownAspectTable shownAspectTable() {
+    ShownAspectTable table{};
+    for (std::size_t a = 0; a < table.size(); ++a) {
+        const bool shown = lampsOf<HeadType>(a) != 0;
+        table[a] = static_cast<std::uint8_t>(shown ? a : static_cast<std::size_t>(Aspect::Stop));
+    }
+    return table;
+}
+
+// Flashing lamps count as lit.
+template <typename HeadType, bool ActiveHigh>
+constexpr LampLevelTable lampLevelTable() {
+    const auto lampMask = static_cast<std::uint8_t>((1U << HeadType::kLampCount) - 1U);
+    const ShownAspectTable shown = shownAspectTable<HeadType>();
+    LampLevelTable table{};
+    for (std::size_t a = 0; a < kAspectCount; ++a) {
+        const std::size_t s = shown[a];
+        const std::uint8_t lit = lampsOf<HeadType>(s);
+        table[a] = ActiveHigh ? lit : static_cast<std::uint8_t>(lampMask & ~lit);
+    }
+    return table;
+}
+
+// Tables generated once per head type. shown() resolves unsupported and out-of-range aspects
+// to Stop, so drivers index the level tables with its result without further checks.
+template <typename HeadType>
+struct HeadTypeTables {
+    static_assert(headTypeIsSafe<HeadType>(), "head type lights conflicting lamps or lacks a steady Stop");
+
+    static constexpr ShownAspectTable kShown = shownAspectTable<HeadType>();
+    static constexpr LampLevelTable kActiveHighLevels = lampLevelTable<HeadType, true>();
+    static constexpr LampLevelTable kActiveLowLevels = lampLevelTable<HeadType, false>();
+
+    static constexpr const LampLevelTable& levels(bool activeHigh) {
+        return activeHigh ? kActiveHighLevels : kActiveLowLevels;
+    }
+    static constexpr std::size_t shown(Aspect aspect) {
+        const auto raw = static_cast<std::uint8_t>(aspect);
+        return raw < kAspectCount ? kShown[raw] : static_cast<std::size_t>(Aspect::Stop);
+    }
+};
+
+static_assert(headTypeIsSafe<ThreeAspectHead>(), "three-aspect patterns light conflicting lamps");
+static_assert(headTypeIsSafe<FourAspectHead>(), "four-aspect patterns light conflicting lamps");
+
+} // namespace railway::drivers
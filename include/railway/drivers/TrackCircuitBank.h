@@ -0,0 +1,116 @@
+#pragma once
+
+#include "railway/Types.h"
+#include "railway/detail/Bits.h"
+#include "railway/drivers/TrackCircuitInput.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::drivers {
+
+// Many track circuits updated together from a packed input bitmap, with the same debounce and
+// stuck-low semantics as TrackCircuitInput::update(), circuit by circuit.
+//
+// State is struct-of-arrays: raw/stable/healthy live in 64-bit words and are updated with
+// word-wide bit operations. The per-circuit timestamps are only touched for the few bits that
+// need them on a given tick: circuits whose raw level just changed, circuits still inside their
+// debounce window and occupied circuits that are still healthy. On a quiet line the cost of
+// update() is a handful of operations per 64 circuits.
+//
+// Circuit i is bit (i % 64) of word (i / 64) in every bitmap. Memory is caller-provided (see
+// StaticTrackCircuitBank); no allocation happens.
+class TrackCircuitBank {
+public:
+    static constexpr std::size_t kBitsPerWord = railway::detail::kBitsPerWord;
+
+    static constexpr std::size_t wordsFor(std::size_t circuits) {
+        return (circuits + kBitsPerWord - 1) / kBitsPerWord;
+    }
+
+    // Word arrays hold wordsFor(capacity) elements, per-circuit arrays `capacity` elements.
+    struct Arrays {
+        std::uint64_t* raw;
+        std::uint64_t* stable;
+        std::uint64_t* healthy;
+        std::uint64_t* armed;
+        std::uint64_t* invert;
+        std::uint64_t* present;
+        railway::Millis* lastRawChangeMs;
+        railway::Millis* stuckLowSinceMs;
+        railway::Millis* debounceMs;
+        railway::Millis* stuckLowFaultMs;
+    };
+
+    TrackCircuitBank(const Arrays& arrays, std::size_t capacity);
+
+    TrackCircuitBank(const TrackCircuitBank&) = delete;
+    TrackCircuitBank& operator=(const TrackCircuitBank&) = delete;
+
+    // Sets up circuit `index` from a TrackCircuitInput config (the pin field is not used: the
+    // circuit's level is bit `index` of the bitmap). Only DebounceMode::Timer is supported.
+    // Returns false if `index` is out of range or the mode is not Timer.
+    bool configure(std::size_t index, const TrackCircuitConfig& cfg);
+
+    // Equivalent of TrackCircuitInput::init() for every configured circuit. `levels` holds
+    // wordsFor(capacity()) words, bit set == pin High.
+    void init(const std::uint64_t* levels);
+
+    // Equivalent of TrackCircuitInput::update(nowMs) for every configured circuit.
+    void update(railway::Millis nowMs, const std::uint64_t* levels);
+
+    // Packed outputs; bits of unconfigured circuits are 0.
+    std::uint64_t occupiedWord(std::size_t word) const;
+    std::uint64_t healthyWord(std::size_t word) const;
+    void copyOccupied(std::uint64_t* out) const;
+    void copyHealthy(std::uint64_t* out) const;
+
+    bool isOccupied(std::size_t index) const;
+    bool isHealthy(std::size_t index) const;
+
+    std::size_t capacity() const;
+    std::size_t wordCount() const;
+
+private:
+    Arrays a_;
+    std::size_t capacity_;
+    std::size_t words_;
+};
+
+namespace detail {
+
+template <std::size_t N>
+struct TrackCircuitBankArrays {
+    static constexpr std::size_t kWords = TrackCircuitBank::wordsFor(N);
+
+    std::array<std::uint64_t, kWords> raw_{};
+    std::array<std::uint64_t, kWords> stable_{};
+    std::array<std::uint64_t, kWords> healthy_{};
+    std::array<std::uint64_t, kWords> armed_{};
+    std::array<std::uint64_t, kWords> invert_{};
+    std::array<std::uint64_t, kWords> present_{};
+    std::array<railway::Millis, N> lastRawChangeMs_{};
+    std::array<railway::Millis, N> stuckLowSinceMs_{};
+    std::array<railway::Millis, N> debounceMs_{};
+    std::array<railway::Millis, N> stuckLowFaultMs_{};
+
+    TrackCircuitBank::Arrays view() {
+        return {raw_.data(),     stable_.data(),          healthy_.data(),         armed_.data(),
+                invert_.data(),  present_.data(),         lastRawChangeMs_.data(), stuckLowSinceMs_.data(),
+                debounceMs_.data(), stuckLowFaultMs_.data()};
+    }
+};
+
+} // namespace detail
+
+// TrackCircuitBank that owns storage for N circuits.
+template <std::size_t N>
+class StaticTrackCircuitBank : private detail::TrackCircuitBankArrays<N>, public TrackCircuitBank {
+    static_assert(N != 0, "bank needs at least one circuit");
+
+public:
+    StaticTrackCircuitBank() : TrackCircuitBank(this->view(), N) {}
+};
+
+} // namespace railway::drivers
@@ -1,42 +1,427 @@
 #pragma once
 
 #include "railway/Types.h"
+#include "railway/drivers/TrackEvent.h"
 #include "railway/hal/IGpio.h"
+#include "railway/hal/PinSnapshot.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 
 namespace railway::drivers {
 
+enum class DebounceMode : std::uint8_t {
+    // Accept a new level once the raw input has not changed for debounceMs.
+    Timer = 0,
+    // Up/down counter over update() samples: +1 per clear sample, -1 per not-clear sample,
+    // saturating at 0 and integrateSamples. The stable state flips only at the two ends, so
+    // isolated glitches cost one sample of latency instead of restarting the window.
+    Integrating = 1,
+};
+
+struct TrackCircuitConfig {
+    railway::hal::Pin pin{0};
+    bool activeLow{true};
+    DebounceMode debounceMode{DebounceMode::Timer};
+    // Timer mode.
+    railway::Millis debounceMs{50};
+    // Integrating mode: consecutive agreeing samples needed to flip a saturated counter
+    // (0 is treated as 1).
+    std::uint8_t integrateSamples{5};
+    railway::Millis stuckLowFaultMs{3000};
+    // Subscribe to pin edges and skip the debounce/fault work on ticks where neither an edge
+    // arrived nor a timer expired. Falls back to polling if the backend has no edge support.
+    bool eventDriven{false};
+};
+
+// Maintenance counters kept by every track circuit. Saturating is not needed in practice:
+// 32-bit counters and millisecond totals cover ~49 days between snapshots.
+struct TrackCircuitStats {
+    // Raw input level changes seen by update().
+    std::uint32_t rawTransitions{0};
+    // Raw excursions that returned to the stable level before being accepted.
+    std::uint32_t rejectedGlitches{0};
+    // Longest continuous not-clear streak, measured from when the stuck-low timer armed.
+    // Compare against stuckLowFaultMs to see how close a circuit came to faulting.
+    railway::Millis longestStuckLowMs{0};
+    // Total time spent unhealthy.
+    railway::Millis timeInFaultMs{0};
+};
+
 // Track circuit input: energized (clear) vs de-energized (occupied/fault).
 // This module does debouncing and basic "stuck-low" fault detection.
-class TrackCircuitInput {
+//
+// `Gpio` is the HAL binding. Instantiating with a concrete (final) backend lets the compiler
+// resolve and inline every pin access; TrackCircuitInput binds to the virtual IGpio interface.
+template <typename Gpio>
+class BasicTrackCircuitInput {
 public:
-    struct Config {
-        railway::hal::Pin pin{0};
-        bool activeLow{true};
-        railway::Millis debounceMs{50};
-        railway::Millis stuckLowFaultMs{3000};
-    };
+    using Config = TrackCircuitConfig;
+
+    // The raw level can be taken from a PinSnapshot; see BasicBlockController.
+    static constexpr bool kUsesPinSnapshot = true;
 
-    explicit TrackCircuitInput(const Config& cfg, railway::hal::IGpio& gpio);
+    explicit BasicTrackCircuitInput(const Config& cfg, Gpio& gpio);
+    ~BasicTrackCircuitInput();
+
+    // May be registered with the backend as an edge listener; must stay at a fixed address.
+    BasicTrackCircuitInput(const BasicTrackCircuitInput&) = delete;
+    BasicTrackCircuitInput& operator=(const BasicTrackCircuitInput&) = delete;
 
     void init();
     void update(railway::Millis nowMs);
+    // Same as update(nowMs), but takes the raw level from a snapshot captured earlier in the tick.
+    void update(railway::Millis nowMs, const railway::hal::PinSnapshot& inputs);
 
     bool isOccupied() const;
     bool isHealthy() const;
 
+    railway::hal::Pin pin() const;
+    Gpio& gpio() const;
+
+    // True when edge subscription succeeded and update() runs in event-driven mode.
+    bool isEventDriven() const;
+
+    // Earliest time at which update() could change state without an input edge (debounce
+    // acceptance, integrating sample, stuck-low arming or fault). Returns false when only an
+    // input edge can change anything. In polling mode edges are not observed, so callers must
+    // also bound their sleep by a sampling period.
+    bool nextDeadlineMs(railway::Millis& deadlineMs) const;
+
+    // In event-driven mode, also passes every edge on the pin to `listener` (e.g. to wake a
+    // sleeping runner). Called in the backend's edge context. Pass nullptr to stop.
+    void forwardEdges(railway::hal::IEdgeListener* listener);
+
+    const TrackCircuitStats& stats() const;
+    void resetStats();
+
+    // Pushes a TrackEvent into `queue` from update() whenever the debounced occupancy or the
+    // health changes. Pass nullptr to detach. The queue must outlive the attachment and may be
+    // shared by several circuits updated from the same thread.
+    void attachEvents(TrackEventQueue* queue);
+
 private:
+    // Latches edges reported by the backend, possibly from interrupt context.
+    class EdgeLatch final : public railway::hal::IEdgeListener {
+    public:
+        void onEdge(const railway::hal::EdgeEvent& event) override {
+            pending_.store(true, std::memory_order_release);
+            railway::hal::IEdgeListener* forward = forward_.load(std::memory_order_acquire);
+            if (forward != nullptr) {
+                forward->onEdge(event);
+            }
+        }
+        bool take() {
+            return pending_.exchange(false, std::memory_order_acq_rel);
+        }
+        bool pending() const {
+            return pending_.load(std::memory_order_acquire);
+        }
+        void forwardTo(railway::hal::IEdgeListener* listener) {
+            forward_.store(listener, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<bool> pending_{false};
+        std::atomic<railway::hal::IEdgeListener*> forward_{nullptr};
+    };
+
+    bool skipUpdate(railway::Millis nowMs);
+    bool deadlineDue(railway::Millis nowMs) const;
     bool readRawClear() const;
+    bool toRawClear(railway::hal::PinLevel level) const;
+    void apply(railway::Millis nowMs, bool newRawClear);
+    void accountStats(railway::Millis nowMs);
+    void emit(TrackEventKind kind, railway::Millis nowMs, railway::Millis sinceMs);
+    void integrate(bool newRawClear);
+    std::uint8_t integrateLimit() const;
 
     Config cfg_{};
-    railway::hal::IGpio& gpio_;
+    Gpio& gpio_;
 
     bool rawClear_{true};
     bool stableClear_{true};
     railway::Millis lastRawChangeMs_{0};
     railway::Millis lastUpdateMs_{0};
+    // Integrating mode: 0 = fully not-clear, integrateLimit() = fully clear.
+    std::uint8_t integrator_{0};
 
     bool healthy_{true};
     railway::Millis stuckLowSinceMs_{0};
+
+    bool eventMode_{false};
+    EdgeLatch edgeLatch_{};
+
+    TrackEventQueue* events_{nullptr};
+    TrackCircuitStats stats_{};
 };
 
+using TrackCircuitInput = BasicTrackCircuitInput<railway::hal::IGpio>;
+
+template <typename Gpio>
+BasicTrackCircuitInput<Gpio>::BasicTrackCircuitInput(const Config& cfg, Gpio& gpio)
+    : cfg_(cfg), gpio_(gpio) {}
+
+template <typename Gpio>
+BasicTrackCircuitInput<Gpio>::~BasicTrackCircuitInput() {
+    if (eventMode_) {
+        gpio_.unsubscribeEdges(cfg_.pin);
+    }
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::init() {
+    gpio_.configure(cfg_.pin, railway::hal::PinMode::InputPullup);
+    if (cfg_.eventDriven) {
+        eventMode_ = gpio_.subscribeEdges(cfg_.pin, railway::hal::Edge::Both, edgeLatch_);
+    }
+    edgeLatch_.take();
+    rawClear_ = readRawClear();
+    stableClear_ = rawClear_;
+    lastRawChangeMs_ = 0;
+    lastUpdateMs_ = 0;
+    integrator_ = stableClear_ ? integrateLimit() : 0;
+    healthy_ = true;
+    stuckLowSinceMs_ = 0;
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::readRawClear() const {
+    return toRawClear(gpio_.read(cfg_.pin));
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::toRawClear(railway::hal::PinLevel level) const {
+    const bool rawHigh = (level == railway::hal::PinLevel::High);
+    // activeLow means "Low" indicates clear/energized is false; we invert accordingly.
+    // Clear means track circuit is energized.
+    return cfg_.activeLow ? rawHigh : !rawHigh;
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::update(railway::Millis nowMs) {
+    if (skipUpdate(nowMs)) {
+        return;
+    }
+    apply(nowMs, readRawClear());
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::update(railway::Millis nowMs, const railway::hal::PinSnapshot& inputs) {
+    if (skipUpdate(nowMs)) {
+        return;
+    }
+    apply(nowMs, toRawClear(inputs.level(cfg_.pin)));
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::skipUpdate(railway::Millis nowMs) {
+    if (!eventMode_ || edgeLatch_.take() || deadlineDue(nowMs)) {
+        return false;
+    }
+    // Nothing can change: the raw level is the one last seen and no timer has expired.
+    accountStats(nowMs);
+    lastUpdateMs_ = nowMs;
+    return true;
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::deadlineDue(railway::Millis nowMs) const {
+    bool due = false;
+    if (cfg_.debounceMode == DebounceMode::Integrating) {
+        // Every sample moves a counter that is not saturated at the stable end.
+        due = integrator_ != (stableClear_ ? integrateLimit() : 0);
+    } else if (rawClear_ != stableClear_) {
+        due = due || ((nowMs - lastRawChangeMs_) >= cfg_.debounceMs);
+    }
+    if (!stableClear_ && healthy_) {
+        // A zero timestamp means the stuck-low timer still has to be armed by apply().
+        due = due || (stuckLowSinceMs_ == 0) || ((nowMs - stuckLowSinceMs_) >= cfg_.stuckLowFaultMs);
+    }
+    return due;
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::apply(railway::Millis nowMs, bool newRawClear) {
+    accountStats(nowMs);
+    lastUpdateMs_ = nowMs;
+    const bool wasClear = stableClear_;
+    const bool wasHealthy = healthy_;
+    const bool wasPending = (rawClear_ != stableClear_);
+
+    if (newRawClear != rawClear_) {
+        rawClear_ = newRawClear;
+        lastRawChangeMs_ = nowMs;
+        ++stats_.rawTransitions;
+    }
+
+    if (cfg_.debounceMode == DebounceMode::Integrating) {
+        integrate(newRawClear);
+    } else if ((nowMs - lastRawChangeMs_) >= cfg_.debounceMs) {
+        // Debounce: accept new state only after it remains stable long enough.
+        stableClear_ = rawClear_;
+    }
+
+    // Fault detection: track circuit stuck "not clear" (de-energized) beyond threshold.
+    if (!stableClear_) {
+        if (stuckLowSinceMs_ == 0) {
+            stuckLowSinceMs_ = nowMs;
+        }
+        if ((nowMs - stuckLowSinceMs_) >= cfg_.stuckLowFaultMs) {
+            healthy_ = false;
+        }
+    } else {
+        stuckLowSinceMs_ = 0;
+        healthy_ = true;
+    }
+
+    if (wasPending && stableClear_ == wasClear && rawClear_ == stableClear_) {
+        ++stats_.rejectedGlitches;
+    }
+
+    if (events_ != nullptr) {
+        const railway::Millis edgeMs = (cfg_.debounceMode == DebounceMode::Timer) ? lastRawChangeMs_ : nowMs;
+        if (wasClear && !stableClear_) {
+            emit(TrackEventKind::Occupied, nowMs, edgeMs);
+        }
+        if (wasHealthy && !healthy_) {
+            emit(TrackEventKind::Fault, nowMs, stuckLowSinceMs_);
+        }
+        if (!wasClear && stableClear_) {
+            emit(TrackEventKind::Cleared, nowMs, edgeMs);
+        }
+        if (!wasHealthy && healthy_) {
+            emit(TrackEventKind::Recovered, nowMs, nowMs);
+        }
+    }
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::accountStats(railway::Millis nowMs) {
+    // Runs before the state changes, so both counters cover the interval since the last update.
+    if (!healthy_) {
+        stats_.timeInFaultMs += nowMs - lastUpdateMs_;
+    }
+    if (!stableClear_ && stuckLowSinceMs_ != 0 && (nowMs - stuckLowSinceMs_) > stats_.longestStuckLowMs) {
+        stats_.longestStuckLowMs = nowMs - stuckLowSinceMs_;
+    }
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::emit(TrackEventKind kind, railway::Millis nowMs, railway::Millis sinceMs) {
+    TrackEvent event;
+    event.pin = cfg_.pin;
+    event.kind = kind;
+    event.atMs = nowMs;
+    event.sinceMs = sinceMs;
+    events_->push(event);
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::integrate(bool newRawClear) {
+    const std::uint8_t limit = integrateLimit();
+    if (newRawClear) {
+        if (integrator_ < limit) {
+            ++integrator_;
+        }
+        if (integrator_ == limit) {
+            stableClear_ = true;
+        }
+    } else {
+        if (integrator_ > 0) {
+            --integrator_;
+        }
+        if (integrator_ == 0) {
+            stableClear_ = false;
+        }
+    }
+}
+
+template <typename Gpio>
+std::uint8_t BasicTrackCircuitInput<Gpio>::integrateLimit() const {
+    return cfg_.integrateSamples == 0 ? 1 : cfg_.integrateSamples;
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::isOccupied() const {
+    // If not clear, treat as occupied (fail-safe).
+    return !stableClear_;
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::isHealthy() const {
+    return healthy_;
+}
+
+template <typename Gpio>
+railway::hal::Pin BasicTrackCircuitInput<Gpio>::pin() const {
+    return cfg_.pin;
+}
+
+template <typename Gpio>
+Gpio& BasicTrackCircuitInput<Gpio>::gpio() const {
+    return gpio_;
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::isEventDriven() const {
+    return eventMode_;
+}
+
+template <typename Gpio>
+bool BasicTrackCircuitInput<Gpio>::nextDeadlineMs(railway::Millis& deadlineMs) const {
+    bool any = false;
+    auto consider = [&](railway::Millis atMs) {
+        deadlineMs = any ? railway::earliest(deadlineMs, atMs) : atMs;
+        any = true;
+    };
+
+    if (eventMode_ && edgeLatch_.pending()) {
+        consider(lastUpdateMs_);
+    }
+    if (cfg_.debounceMode == DebounceMode::Integrating) {
+        if (integrator_ != (stableClear_ ? integrateLimit() : 0)) {
+            consider(lastUpdateMs_);
+        }
+    } else if (rawClear_ != stableClear_) {
+        consider(lastRawChangeMs_ + cfg_.debounceMs);
+    }
+    if (!stableClear_ && healthy_) {
+        consider(stuckLowSinceMs_ == 0 ? lastUpdateMs_ : stuckLowSinceMs_ + cfg_.stuckLowFaultMs);
+    }
+    return any;
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::forwardEdges(railway::hal::IEdgeListener* listener) {
+    edgeLatch_.forwardTo(listener);
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::attachEvents(TrackEventQueue* queue) {
+    events_ = queue;
+}
+
+template <typename Gpio>
+const TrackCircuitStats& BasicTrackCircuitInput<Gpio>::stats() const {
+    return stats_;
+}
+
+template <typename Gpio>
+void BasicTrackCircuitInput<Gpio>::resetStats() {
+    stats_ = TrackCircuitStats{};
+}
+
+// Copies the statistics of `count` circuits into `out`, e.g. for a periodic maintenance report.
+template <typename Gpio>
+void snapshotStats(const BasicTrackCircuitInput<Gpio>* const* circuits, std::size_t count, TrackCircuitStats* out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = circuits[i]->stats();
+    }
+}
+
+// The virtual binding is compiled once in TrackCircuitInput.cpp.
+extern template class BasicTrackCircuitInput<railway::hal::IGpio>;
+
 } // namespace railway::drivers
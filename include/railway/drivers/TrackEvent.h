@@ -0,0 +1,36 @@
+#pragma once
+
+#include "railway/SpscRing.h"
+#include "railway/Types.h"
+#include "railway/hal/IGpio.h"
+
+#include <cstdint>
+
+namespace railway::drivers {
+
+enum class TrackEventKind : std::uint8_t {
+    Occupied = 0,
+    Cleared = 1,
+    Fault = 2,
+    Recovered = 3,
+};
+
+// One change of a track circuit's debounced state.
+struct TrackEvent {
+    railway::hal::Pin pin{0};
+    TrackEventKind kind{TrackEventKind::Occupied};
+    // update() time at which the debounced state changed.
+    railway::Millis atMs{0};
+    // Occupied/Cleared: time of the raw edge that was accepted (equal to atMs in integrating
+    // mode). Fault: time the stuck-low timer was armed. Recovered: equal to atMs.
+    railway::Millis sinceMs{0};
+};
+
+// Filled by track circuit update() (producer), drained by downstream logic or a logger
+// (consumer). A full queue drops new events and counts them in dropped().
+using TrackEventQueue = railway::SpscRing<TrackEvent>;
+
+template <std::size_t N>
+using StaticTrackEventQueue = railway::StaticSpscRing<TrackEvent, N>;
+
+} // namespace railway::drivers
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "railway/hal/IClock.h"
+
+namespace railway::hal {
+
+// Arduino/ESP32 clock over millis()/micros().
+// micros() is 32 bits and wraps every ~71.6 minutes; nowUs() extends it to 64 bits, which
+// requires it to be called at least once per wrap period (any periodic tick does this).
+// Not safe to call concurrently from an ISR and the main loop.
+class ArduinoClock final : public IClock {
+public:
+    railway::Millis nowMs() const override;
+    railway::Micros nowUs() const override;
+
+private:
+    mutable std::uint32_t lastMicros_{0};
+    mutable std::uint32_t wraps_{0};
+};
+
+} // namespace railway::hal
@@ -11,6 +11,15 @@ public:
     void configure(Pin pin, PinMode mode) override;
     PinLevel read(Pin pin) const override;
     void write(Pin pin, PinLevel level) override;
+    PortMask readPort(Port port, PortMask mask) const override;
+    void writeMasked(Port port, PortMask mask, PortMask value) override;
+
+    // Backed by attachInterrupt(CHANGE). Interrupt slots are a global resource shared by all
+    // ArduinoGpio instances; subscribeEdges() fails once kMaxEdgePins are in use or when
+    // `pin` has no external interrupt.
+    static constexpr std::size_t kMaxEdgePins = 8;
+    bool subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) override;
+    void unsubscribeEdges(Pin pin) override;
 };
 
 } // namespace railway::hal
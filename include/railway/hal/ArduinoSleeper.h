@@ -0,0 +1,26 @@
+#pragma once
+
+#include "railway/hal/ISleeper.h"
+
+#include <atomic>
+
+namespace railway::hal {
+
+// Arduino/ESP32 sleeper. wake() may be called from an ISR.
+//
+// On ESP32 the calling task blocks once on its task notification until the deadline, so the
+// CPU stays in the RTOS idle task (and automatic light sleep, where enabled) for the whole
+// interval; wake() gives the notification. Bare AVR has no scheduler and falls back to
+// delay(1) steps.
+class ArduinoSleeper final : public ISleeper {
+public:
+    void sleepUntilMs(railway::Millis deadlineMs) override;
+    void wake() override;
+
+private:
+    std::atomic<bool> woken_{false};
+    // ESP32: FreeRTOS handle of the sleeping task (TaskHandle_t), set by sleepUntilMs().
+    std::atomic<void*> task_{nullptr};
+};
+
+} // namespace railway::hal
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "railway/hal/IGpio.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::hal {
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "pin words must be lock-free atomics");
+
+// Pin levels and modes for the whole 16-bit pin space, packed into lock-free 64-bit atomic
+// words (levels 1 bit per pin, modes 2 bits per pin). Loads are acquire and stores release,
+// and every mutation is a single read-modify-write on one word, so concurrent threads (or
+// processes, when placed in shared memory) never observe a torn or half-applied update.
+// An all-zero image is valid: every pin Low and configured as Input.
+struct AtomicPinImage {
+    static constexpr std::size_t kMaxPins = 65536;
+    static constexpr std::size_t kPinsPerWord = 64;
+    static constexpr std::size_t kLevelWords = kMaxPins / kPinsPerWord;
+    static constexpr std::size_t kModeBits = 2;
+    static constexpr std::size_t kModesPerWord = 64 / kModeBits;
+    static constexpr std::size_t kModeWords = kMaxPins / kModesPerWord;
+
+    std::atomic<std::uint64_t> levels[kLevelWords];
+    std::atomic<std::uint64_t> modes[kModeWords];
+
+    PinLevel read(Pin pin) const;
+    void setLevel(Pin pin, PinLevel level);
+    PinMode mode(Pin pin) const;
+    void setMode(Pin pin, PinMode mode);
+
+    PortMask readPort(Port port, PortMask mask) const;
+    void writeMasked(Port port, PortMask mask, PortMask value);
+
+    // Out-of-range indices read as 0 and are ignored on write.
+    std::uint64_t levelWord(std::size_t index) const;
+    void setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levelBits);
+};
+
+} // namespace railway::hal
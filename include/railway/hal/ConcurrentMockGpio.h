@@ -0,0 +1,44 @@
+#pragma once
+
+#include "railway/hal/AtomicPinImage.h"
+#include "railway/hal/IGpio.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::hal {
+
+// Thread-safe host GPIO model for running a plant simulator, the controller and observers on
+// separate threads without locks. Pins live in an AtomicPinImage: every read is an acquire
+// load and every write a single release RMW on the pin's word, so a reader that sees a level
+// also sees everything its writer did before driving it. Concurrent writers to different pins
+// of the same word are safe too.
+//
+// Unlike MockGpio there is no journal and no edge delivery (controllers poll); those need a
+// single owning thread.
+class ConcurrentMockGpio final : public IGpio {
+public:
+    static constexpr std::size_t kMaxPins = AtomicPinImage::kMaxPins;
+    static constexpr std::size_t kPinsPerWord = AtomicPinImage::kPinsPerWord;
+    static constexpr std::size_t kLevelWords = AtomicPinImage::kLevelWords;
+
+    void configure(Pin pin, PinMode mode) override;
+    PinLevel read(Pin pin) const override;
+    void write(Pin pin, PinLevel level) override;
+    PortMask readPort(Port port, PortMask mask) const override;
+    void readMany(const Pin* pins, std::size_t count, PinLevel* levels) const override;
+    void writeMasked(Port port, PortMask mask, PortMask value) override;
+
+    // Simulator side, same semantics as the MockGpio equivalents; callable from any thread.
+    void setInputLevel(Pin pin, PinLevel level);
+    PinMode mode(Pin pin) const;
+
+    std::uint64_t levelWord(std::size_t index) const;
+    void setLevelWord(std::size_t index, std::uint64_t levels);
+    void setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levels);
+
+private:
+    AtomicPinImage pins_{};
+};
+
+} // namespace railway::hal
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "railway/SpscRing.h"
+#include "railway/Types.h"
+#include "railway/hal/IGpio.h"
+
+namespace railway::hal {
+
+// One output write as seen by a GPIO backend.
+struct GpioWriteRecord {
+    Pin pin{0};
+    PinLevel level{PinLevel::Low};
+    railway::Millis atMs{0};
+};
+
+// Filled by the control loop (producer), drained by an observer thread (consumer).
+using GpioJournal = railway::SpscRing<GpioWriteRecord>;
+
+template <std::size_t N>
+using StaticGpioJournal = railway::StaticSpscRing<GpioWriteRecord, N>;
+
+} // namespace railway::hal
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::hal {
+
+using AdcChannel = std::uint8_t;
+// Raw conversion result, right-aligned (e.g. 0..4095 for a 12-bit converter).
+using AdcSample = std::uint16_t;
+
+// Continuously sampled analog inputs. Backends typically convert in the background (timer
+// trigger + DMA) and hand out blocks of samples, so consumers work on whole buffers instead of
+// one conversion per call.
+class IAdc {
+public:
+    virtual ~IAdc() = default;
+
+    // Starts continuous conversion on `channel`. Returns false when the channel does not exist.
+    virtual bool start(AdcChannel channel) = 0;
+
+    // Moves up to `max` samples converted on `channel` since the last call into `out`, oldest
+    // first, and returns how many were copied. Returns 0 when none are pending.
+    virtual std::size_t read(AdcChannel channel, AdcSample* out, std::size_t max) = 0;
+};
+
+} // namespace railway::hal
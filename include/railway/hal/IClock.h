@@ -2,12 +2,30 @@
 
 #include "railway/Types.h"
 
+#include <cstdint>
+
 namespace railway::hal {
 
 class IClock {
 public:
     virtual ~IClock() = default;
+
+    // Wraps after ~49.7 days; use nowUs() for intervals that may span longer.
     virtual railway::Millis nowMs() const = 0;
+
+    // Monotonic microseconds. The default only has millisecond resolution and inherits the
+    // nowMs() wrap; real clocks should override it.
+    virtual railway::Micros nowUs() const {
+        return static_cast<railway::Micros>(nowMs()) * 1000U;
+    }
+
+    // Raw hardware counter for profiling, running at ticksPerSecond(). Defaults to nowUs().
+    virtual std::uint64_t nowTicks() const {
+        return nowUs();
+    }
+    virtual std::uint64_t ticksPerSecond() const {
+        return 1000000U;
+    }
 };
 
 } // namespace railway::hal
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "railway/Types.h"
+
+#include <cstddef>
 #include <cstdint>
 
 namespace railway::hal {
@@ -17,6 +20,49 @@ enum class PinMode : std::uint8_t {
 
 using Pin = std::uint16_t;
 
+// Pins are grouped into logical ports of 32 consecutive pins so that bulk operations can
+// be expressed as one 32-bit mask. Bit n of a port mask refers to pin (port * 32 + n).
+using Port = std::uint16_t;
+using PortMask = std::uint32_t;
+
+constexpr std::size_t kPinsPerPort = 32;
+
+constexpr Port portOf(Pin pin) {
+    return static_cast<Port>(pin / kPinsPerPort);
+}
+
+constexpr PortMask maskOf(Pin pin) {
+    return PortMask{1} << (pin % kPinsPerPort);
+}
+
+constexpr Pin pinOf(Port port, std::size_t bit) {
+    return static_cast<Pin>(port * kPinsPerPort + bit);
+}
+
+enum class Edge : std::uint8_t {
+    Rising = 1,
+    Falling = 2,
+    Both = 3,
+};
+
+constexpr bool includesEdge(Edge subscribed, Edge edge) {
+    return (static_cast<std::uint8_t>(subscribed) & static_cast<std::uint8_t>(edge)) != 0;
+}
+
+struct EdgeEvent {
+    Pin pin{0};
+    Edge edge{Edge::Rising};
+    railway::Millis atMs{0};
+};
+
+// Receives pin edges from a backend. On embedded targets onEdge() runs in interrupt context:
+// keep it short and do not call back into the GPIO backend.
+class IEdgeListener {
+public:
+    virtual ~IEdgeListener() = default;
+    virtual void onEdge(const EdgeEvent& event) = 0;
+};
+
 class IGpio {
 public:
     virtual ~IGpio() = default;
@@ -24,6 +70,26 @@ public:
     virtual void configure(Pin pin, PinMode mode) = 0;
     virtual PinLevel read(Pin pin) const = 0;
     virtual void write(Pin pin, PinLevel level) = 0;
+
+    // Samples the pins of `port` selected by `mask` in one call. Bits outside `mask` are zero.
+    // The default falls back to one read() per selected pin; backends that can latch a whole
+    // port register at once should override it.
+    virtual PortMask readPort(Port port, PortMask mask) const;
+
+    // Samples `count` arbitrary pins into `levels`.
+    virtual void readMany(const Pin* pins, std::size_t count, PinLevel* levels) const;
+
+    // Drives the pins of `port` selected by `mask` to the matching bits of `value`; pins outside
+    // `mask` keep their level, even if another context writes them concurrently. Backends with
+    // port output registers should apply the change in one store, or one clear store followed
+    // by one set store. The default falls back to write() per pin, Low bits first.
+    virtual void writeMasked(Port port, PortMask mask, PortMask value);
+
+    // Optional edge notification. Returns false when the backend cannot report edges on `pin`
+    // (the default), in which case callers must keep polling. One listener per pin; a new
+    // subscription replaces the previous one.
+    virtual bool subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener);
+    virtual void unsubscribeEdges(Pin pin);
 };
 
 } // namespace railway::hal
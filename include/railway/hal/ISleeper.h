@@ -0,0 +1,21 @@
+#pragma once
+
+#include "railway/Types.h"
+
+namespace railway::hal {
+
+// Blocks the control loop between deadlines, for tickless scheduling.
+class ISleeper {
+public:
+    virtual ~ISleeper() = default;
+
+    // Returns once the sleeper's clock reaches `deadlineMs` or wake() is called, whichever comes
+    // first. Returns immediately if the deadline has passed or a wake() is already pending.
+    virtual void sleepUntilMs(railway::Millis deadlineMs) = 0;
+
+    // Ends the current sleep, or the next one if none is in progress. Safe to call from another
+    // thread or from an edge listener.
+    virtual void wake() = 0;
+};
+
+} // namespace railway::hal
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "railway/hal/IClock.h"
+#include "railway/hal/IGpio.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// GPIO profiling is opt-in for firmware builds (define RAILWAY_GPIO_PROFILING=1, or configure
+// CMake with RAILWAY_ENABLE_GPIO_PROFILING). When 0, InstrumentedGpio is a plain forwarder with
+// no clock reads and no statistics storage.
+#ifndef RAILWAY_GPIO_PROFILING
+#define RAILWAY_GPIO_PROFILING 0
+#endif
+
+namespace railway::hal {
+
+enum class GpioOp : std::uint8_t {
+    Configure = 0,
+    Read = 1,
+    Write = 2,
+    ReadPort = 3,
+    ReadMany = 4,
+    WriteMasked = 5,
+};
+
+// Bucket 0 counts calls that took 0 ticks, bucket b (b >= 1) calls that took [2^(b-1), 2^b)
+// ticks; the last bucket also absorbs everything slower.
+constexpr std::size_t kLatencyBuckets = 32;
+
+// Statistics for one (operation, key) pair. The key is the pin for Configure/Read/Write, the
+// port for ReadPort/WriteMasked and 0 for ReadMany. Call and bucket counts saturate.
+struct GpioLatencyStats {
+    GpioOp op{GpioOp::Read};
+    std::uint16_t key{0};
+    std::uint32_t calls{0};
+    std::uint64_t totalTicks{0};
+    std::uint64_t maxTicks{0};
+    std::array<std::uint32_t, kLatencyBuckets> buckets{};
+};
+
+// Decorator that times every call into the wrapped backend with IClock::nowTicks() and keeps
+// per-pin, per-operation call counts and log2 latency histograms in a fixed table, so the hot
+// path never allocates. Single-threaded, like the drivers that use it.
+class InstrumentedGpio final : public IGpio {
+public:
+    static constexpr bool kEnabled = RAILWAY_GPIO_PROFILING != 0;
+    static constexpr std::size_t kMaxEntries = 64;
+
+    InstrumentedGpio(IGpio& inner, const IClock& clock);
+
+    void configure(Pin pin, PinMode mode) override;
+    PinLevel read(Pin pin) const override;
+    void write(Pin pin, PinLevel level) override;
+    PortMask readPort(Port port, PortMask mask) const override;
+    void readMany(const Pin* pins, std::size_t count, PinLevel* levels) const override;
+    void writeMasked(Port port, PortMask mask, PortMask value) override;
+    bool subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) override;
+    void unsubscribeEdges(Pin pin) override;
+
+    // Copies up to `max` recorded entries into `out` and returns how many were written.
+    // Always 0 when profiling is compiled out.
+    std::size_t exportStats(GpioLatencyStats* out, std::size_t max) const;
+    std::size_t entryCount() const;
+    // Calls that were timed but found no free table entry for their (operation, key).
+    std::uint32_t untrackedCalls() const;
+    void reset();
+
+    // Tick rate of the recorded latencies.
+    std::uint64_t ticksPerSecond() const;
+
+private:
+    std::uint64_t begin() const;
+    void end(GpioOp op, std::uint16_t key, std::uint64_t startTicks) const;
+
+    IGpio& inner_;
+    const IClock& clock_;
+
+#if RAILWAY_GPIO_PROFILING
+    // Open-addressed by (op, key); used_ marks occupied slots, so a slot stays keyed however
+    // its counters evolve. Mutable because reads are timed too.
+    mutable std::array<GpioLatencyStats, kMaxEntries> entries_{};
+    mutable std::array<bool, kMaxEntries> used_{};
+    mutable std::size_t entryCount_{0};
+    mutable std::uint32_t untracked_{0};
+#endif
+};
+
+} // namespace railway::hal
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "railway/SpscRing.h"
+#include "railway/hal/IAdc.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::hal {
+
+// Host-side IAdc: tests and simulations inject sample blocks per channel and the driver reads
+// them back in order. Each channel buffers up to kSamplesPerChannel samples; injecting more
+// before they are read counts overruns, like a DMA buffer that was not serviced in time.
+// inject() and read() may run on different threads (one each).
+class MockAdc final : public IAdc {
+public:
+    static constexpr std::size_t kChannels = 8;
+    static constexpr std::size_t kSamplesPerChannel = 4096;
+
+    bool start(AdcChannel channel) override;
+    std::size_t read(AdcChannel channel, AdcSample* out, std::size_t max) override;
+
+    // Queues `count` samples on `channel`; returns how many fit.
+    std::size_t inject(AdcChannel channel, const AdcSample* samples, std::size_t count);
+    std::size_t injectConstant(AdcChannel channel, AdcSample value, std::size_t count);
+
+    bool isStarted(AdcChannel channel) const;
+    std::size_t pending(AdcChannel channel) const;
+    std::size_t overruns(AdcChannel channel) const;
+
+private:
+    railway::StaticSpscRing<AdcSample, kSamplesPerChannel> channels_[kChannels];
+    bool started_[kChannels]{};
+};
+
+} // namespace railway::hal
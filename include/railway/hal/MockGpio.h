@@ -1,26 +1,84 @@
 #pragma once
 
+#include "railway/hal/GpioJournal.h"
+#include "railway/hal/IClock.h"
 #include "railway/hal/IGpio.h"
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 
 namespace railway::hal {
 
+// Host GPIO model covering the whole 16-bit pin space.
+// Levels are bit-packed 64 pins per word (8 KiB) and modes 2 bits per pin (16 KiB), so a
+// simulator can drive or scan thousands of pins per step through the word accessors. Edge
+// subscriptions add an 8 KiB subscribed-pin bitmap and a fixed subscription table; the
+// object is large enough that callers should not put it on a small stack.
 class MockGpio final : public IGpio {
 public:
+    static constexpr std::size_t kMaxPins = 65536;
+    static constexpr std::size_t kPinsPerWord = 64;
+    static constexpr std::size_t kLevelWords = kMaxPins / kPinsPerWord;
+
     void configure(Pin pin, PinMode mode) override;
     PinLevel read(Pin pin) const override;
     void write(Pin pin, PinLevel level) override;
+    PortMask readPort(Port port, PortMask mask) const override;
+    void readMany(const Pin* pins, std::size_t count, PinLevel* levels) const override;
+    void writeMasked(Port port, PortMask mask, PortMask value) override;
+    bool subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) override;
+    void unsubscribeEdges(Pin pin) override;
 
     // Drives the level that will be observed by read(). Useful for simulation/tests.
     void setInputLevel(Pin pin, PinLevel level);
 
+    PinMode mode(Pin pin) const;
+
+    // Time source for journal records and edge events (timestamps are 0 without one).
+    void setClock(const IClock* clock);
+
+    // Records every subsequent write()/writeMasked() pin change into `journal`. Inputs driven
+    // via setInputLevel() or the word accessors are not recorded. Pass nullptr to detach.
+    // The journal must outlive the attachment.
+    void attachJournal(GpioJournal* journal);
+
+    // Word-level access for simulators: word `index` holds pins [index * 64, index * 64 + 63],
+    // bit n being pin (index * 64 + n). Out-of-range indices read as 0 and are ignored on write.
+    // Level changes made through any mutator are delivered to edge subscribers synchronously.
+    std::uint64_t levelWord(std::size_t index) const;
+    void setLevelWord(std::size_t index, std::uint64_t levels);
+    void setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levels);
+    void toggleLevelWord(std::size_t index, std::uint64_t mask);
+
 private:
-    static constexpr std::size_t kMaxPins = 256;
+    static constexpr std::size_t kModeBits = 2;
+    static constexpr std::size_t kModesPerWord = 64 / kModeBits;
+    static constexpr std::size_t kModeWords = kMaxPins / kModesPerWord;
+    static constexpr std::size_t kMaxEdgeSubscriptions = 256;
+
+    struct EdgeSubscription {
+        Pin pin{0};
+        Edge edges{Edge::Both};
+        IEdgeListener* listener{nullptr};
+    };
+
+    void setLevel(Pin pin, PinLevel level);
+    void storeWord(std::size_t index, std::uint64_t levels);
+    void notifyEdges(std::size_t index, std::uint64_t changed, std::uint64_t levels);
+    railway::Millis now() const;
+    void record(Pin pin, PinLevel level, railway::Millis atMs);
+
+    std::array<std::uint64_t, kModeWords> modes_{};
+    std::array<std::uint64_t, kLevelWords> levels_{};
+
+    const IClock* clock_{nullptr};
+    GpioJournal* journal_{nullptr};
 
-    std::array<PinMode, kMaxPins> modes_{};
-    std::array<PinLevel, kMaxPins> levels_{};
+    // One bit per pin with an edge listener, so unsubscribed changes cost a single AND.
+    std::array<std::uint64_t, kLevelWords> subscribed_{};
+    std::array<EdgeSubscription, kMaxEdgeSubscriptions> subscriptions_{};
+    std::size_t subscriptionCount_{0};
 };
 
 } // namespace railway::hal
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "railway/hal/IClock.h"
+#include "railway/hal/IGpio.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::hal {
+
+enum class StuckAt : std::uint8_t {
+    None = 0,
+    Low = 1,
+    High = 2,
+};
+
+// Disturbances applied to what the controller reads from one input pin. All times are in
+// milliseconds of the decorator's clock.
+struct NoiseProfile {
+    // True edges only become visible this long after they happen.
+    railway::Millis slowEdgeMs{0};
+    // For this long after each visible edge the pin chatters back to its old level in
+    // pseudo-random 1ms slots (contact bounce). Capped at 64.
+    railway::Millis bounceMs{0};
+    // Isolated inverted pulses of glitchLengthMs, separated by gaps drawn uniformly from
+    // [1, 2 * glitchMeanIntervalMs] ms. 0 disables glitches. Both are capped at
+    // NoisyGpio::kMaxGlitchIntervalMs.
+    railway::Millis glitchMeanIntervalMs{0};
+    railway::Millis glitchLengthMs{1};
+    // Forces the pin to a fixed level during [stuckFromMs, stuckUntilMs).
+    StuckAt stuck{StuckAt::None};
+    railway::Millis stuckFromMs{0};
+    railway::Millis stuckUntilMs{0};
+};
+
+// Decorator that corrupts reads of selected pins according to a per-pin NoiseProfile, for
+// stress-testing debounce and fault detection. Writes and edge subscriptions pass through.
+//
+// Each pin draws from its own xorshift64* stream derived from the seed, and bounce patterns
+// and glitch times are drawn once per event rather than per read. The same seed, profiles
+// and read sequence therefore reproduce the same run exactly. Not thread-safe.
+class NoisyGpio final : public IGpio {
+public:
+    static constexpr std::size_t kMaxNoisyPins = 32;
+    static constexpr railway::Millis kMaxBounceMs = 64;
+    // Caps glitchMeanIntervalMs and glitchLengthMs (~6 days) so that every glitch deadline
+    // stays within the wrap-safe comparison range.
+    static constexpr railway::Millis kMaxGlitchIntervalMs = railway::Millis{1} << 29;
+
+    NoisyGpio(IGpio& inner, const IClock& clock, std::uint64_t seed);
+
+    void configure(Pin pin, PinMode mode) override;
+    PinLevel read(Pin pin) const override;
+    void write(Pin pin, PinLevel level) override;
+    PortMask readPort(Port port, PortMask mask) const override;
+    void readMany(const Pin* pins, std::size_t count, PinLevel* levels) const override;
+    void writeMasked(Port port, PortMask mask, PortMask value) override;
+    bool subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) override;
+    void unsubscribeEdges(Pin pin) override;
+
+    // Adds or replaces the profile for `pin` and restarts its noise stream. Returns false when
+    // kMaxNoisyPins other pins already have one.
+    bool setProfile(Pin pin, const NoiseProfile& profile);
+    void clearProfile(Pin pin);
+
+    // Restarts every pin's noise stream from `seed`.
+    void reseed(std::uint64_t seed);
+
+    // Reads whose result differed from the backend level.
+    std::uint64_t corruptedReads() const;
+
+private:
+    struct NoisyPin {
+        Pin pin{0};
+        bool used{false};
+        NoiseProfile profile{};
+        std::uint64_t rng{0};
+        bool started{false};
+        bool target{false};
+        railway::Millis targetSinceMs{0};
+        bool visible{false};
+        railway::Millis visibleSinceMs{0};
+        std::uint64_t bounceSlots{0};
+        railway::Millis nextGlitchMs{0};
+    };
+
+    NoisyPin* find(Pin pin) const;
+    void restart(NoisyPin& p) const;
+    bool apply(NoisyPin& p, bool level, railway::Millis nowMs) const;
+
+    IGpio& inner_;
+    const IClock& clock_;
+    std::uint64_t seed_;
+
+    mutable std::array<NoisyPin, kMaxNoisyPins> pins_{};
+    mutable std::uint64_t corrupted_{0};
+};
+
+} // namespace railway::hal
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "railway/hal/IGpio.h"
+
+#include <array>
+#include <cstddef>
+
+namespace railway::hal {
+
+// Consistent, per-tick image of a set of input pins.
+// Pins are registered once with watch(); capture() then samples every watched port with a
+// single readPort() call so all inputs observed during a tick come from the same instant.
+class PinSnapshot {
+public:
+    static constexpr std::size_t kMaxPorts = 8;
+
+    // Adds `pin` to the sampled set. Returns false if the port table is full.
+    bool watch(Pin pin);
+    void clear();
+
+    // `Gpio` is IGpio or any concrete backend exposing the same readPort().
+    template <typename Gpio>
+    void capture(const Gpio& gpio) {
+        for (std::size_t i = 0; i < count_; ++i) {
+            entries_[i].levels = gpio.readPort(entries_[i].port, entries_[i].mask);
+        }
+    }
+
+    // Level of `pin` at the last capture(). Unwatched pins read as Low (fail-safe).
+    PinLevel level(Pin pin) const;
+
+    std::size_t portCount() const;
+
+private:
+    struct Entry {
+        Port port{0};
+        PortMask mask{0};
+        PortMask levels{0};
+    };
+
+    std::array<Entry, kMaxPorts> entries_{};
+    std::size_t count_{0};
+};
+
+} // namespace railway::hal
@@ -3,10 +3,33 @@
 #include "railway/hal/IClock.h"
 #include "railway/hal/IGpio.h"
 
+#ifdef ARDUINO
+#include "railway/hal/ArduinoClock.h"
+#include "railway/hal/ArduinoGpio.h"
+#else
+#include "railway/hal/MockGpio.h"
+#include "railway/hal/SteadyClock.h"
+#endif
+
 namespace railway::hal {
 
-// Host/embedded selection happens at link-time.
+// Compile-time HAL selection, for the Basic* templates (e.g. BasicBlockController<PlatformGpio,
+// PlatformClock>).
+#ifdef ARDUINO
+using PlatformGpio = ArduinoGpio;
+using PlatformClock = ArduinoClock;
+#else
+using PlatformGpio = MockGpio;
+using PlatformClock = SteadyClock;
+#endif
+
+// Host/embedded selection happens at link-time. On host builds gpio() can be redirected to a
+// SharedMemoryGpio segment through the RAILWAY_GPIO_SHM environment variable.
 IGpio& gpio();
 IClock& clock();
 
+// Typed platform backends; the same instances as gpio()/clock() unless gpio() was redirected.
+PlatformGpio& platformGpio();
+PlatformClock& platformClock();
+
 } // namespace railway::hal
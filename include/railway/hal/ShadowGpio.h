@@ -0,0 +1,61 @@
+#pragma once
+
+#include "railway/hal/IGpio.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::hal {
+
+// Write-coalescing decorator. Output writes update a shadow image only; flush() sends the
+// pins whose level differs from what was last sent, as one writeMasked() per port. Writes that
+// do not change the shadow are counted and dropped, and a pin toggled back before flush()
+// costs nothing. Call flush() once at the end of each tick.
+//
+// Ports [0, kMaxPorts) are shadowed; pins beyond that are passed straight through.
+// Reads and edge subscriptions are passed through, with not-yet-flushed outputs reading back
+// their shadow level.
+class ShadowGpio final : public IGpio {
+public:
+    static constexpr std::size_t kMaxPorts = 64;
+
+    explicit ShadowGpio(IGpio& inner);
+
+    void configure(Pin pin, PinMode mode) override;
+    PinLevel read(Pin pin) const override;
+    void write(Pin pin, PinLevel level) override;
+    PortMask readPort(Port port, PortMask mask) const override;
+    void writeMasked(Port port, PortMask mask, PortMask value) override;
+    bool subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) override;
+    void unsubscribeEdges(Pin pin) override;
+
+    // Sends pending changes to the wrapped backend. Returns the number of port writes issued.
+    std::size_t flush();
+
+    bool hasPendingWrites() const;
+
+    // Pin writes dropped because they did not change the shadow level.
+    std::uint32_t suppressedWrites() const;
+    // Port writes issued by flush().
+    std::uint32_t flushedWrites() const;
+    void resetCounters();
+
+private:
+    PortMask pending(Port port) const;
+
+    IGpio& inner_;
+
+    // desired_: levels requested by drivers; sent_: levels last written to inner_.
+    // A pin is only compared against sent_ once it has been written at least once.
+    std::array<PortMask, kMaxPorts> desired_{};
+    std::array<PortMask, kMaxPorts> desiredKnown_{};
+    std::array<PortMask, kMaxPorts> sent_{};
+    std::array<PortMask, kMaxPorts> sentKnown_{};
+    std::uint64_t touchedPorts_{0};
+
+    std::uint32_t suppressed_{0};
+    std::uint32_t flushed_{0};
+};
+
+} // namespace railway::hal
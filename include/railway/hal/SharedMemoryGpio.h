@@ -0,0 +1,59 @@
+#pragma once
+
+#include "railway/hal/IGpio.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace railway::hal {
+
+// GPIO backend living in a POSIX shared-memory segment, so a plant simulator and one or more
+// controller processes can share one pin image without sockets or serialization.
+// Every pin word is a lock-free std::atomic, so concurrent writers never tear a word. Edge
+// subscriptions are not supported; controllers poll.
+class SharedMemoryGpio final : public IGpio {
+public:
+    static constexpr std::size_t kMaxPins = 65536;
+    static constexpr std::size_t kPinsPerWord = 64;
+    static constexpr std::size_t kLevelWords = kMaxPins / kPinsPerWord;
+
+    SharedMemoryGpio() = default;
+    ~SharedMemoryGpio() override;
+
+    SharedMemoryGpio(const SharedMemoryGpio&) = delete;
+    SharedMemoryGpio& operator=(const SharedMemoryGpio&) = delete;
+
+    // Maps the segment `name` (POSIX shm name, e.g. "/railway-gpio"). With `create` the segment
+    // is created (or reused) and initialised if new; otherwise it must already exist.
+    // A segment that another process is still creating is waited for (up to ~100 ms) until
+    // its layout is published. Returns false on any OS error or layout mismatch; the object
+    // then stays closed.
+    bool open(const char* name, bool create);
+    void close();
+    bool isOpen() const;
+
+    // Removes the segment name; processes that have it mapped keep working.
+    static bool remove(const char* name);
+
+    // While closed, reads return Low and writes are ignored.
+    void configure(Pin pin, PinMode mode) override;
+    PinLevel read(Pin pin) const override;
+    void write(Pin pin, PinLevel level) override;
+    PortMask readPort(Port port, PortMask mask) const override;
+    void writeMasked(Port port, PortMask mask, PortMask value) override;
+
+    // Simulator side: drives an input, same semantics as MockGpio::setInputLevel().
+    void setInputLevel(Pin pin, PinLevel level);
+    PinMode mode(Pin pin) const;
+
+    std::uint64_t levelWord(std::size_t index) const;
+    void setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levels);
+
+private:
+    struct Layout;
+
+    Layout* layout_{nullptr};
+};
+
+} // namespace railway::hal
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "railway/hal/IClock.h"
+
+#include <atomic>
+
+namespace railway::hal {
+
+// Virtual-time clock for simulation: time only moves when advanced explicitly, so a run can
+// go as fast as the CPU allows and is fully reproducible. Reads are safe from other threads.
+class SimulatedClock final : public IClock {
+public:
+    explicit SimulatedClock(railway::Micros startUs = 0);
+
+    railway::Millis nowMs() const override;
+    railway::Micros nowUs() const override;
+
+    void advanceUs(railway::Micros deltaUs);
+    void advanceMs(railway::Millis deltaMs);
+    // Jumps to `us`; moving backwards is ignored to keep the clock monotonic.
+    void setUs(railway::Micros us);
+
+private:
+    std::atomic<railway::Micros> nowUs_;
+};
+
+} // namespace railway::hal
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "railway/hal/ISleeper.h"
+#include "railway/hal/SimulatedClock.h"
+
+#include <atomic>
+
+namespace railway::hal {
+
+// Virtual-time sleeper: "sleeping" advances the SimulatedClock straight to the deadline, unless
+// a wake() is pending, so tickless loops run as fast as the CPU allows.
+class SimulatedSleeper final : public ISleeper {
+public:
+    explicit SimulatedSleeper(SimulatedClock& clock);
+
+    void sleepUntilMs(railway::Millis deadlineMs) override;
+    void wake() override;
+
+private:
+    SimulatedClock& clock_;
+    std::atomic<bool> woken_{false};
+};
+
+} // namespace railway::hal
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "railway/hal/IClock.h"
+
+#include <chrono>
+
+namespace railway::hal {
+
+// Host clock backed by std::chrono::steady_clock.
+class SteadyClock final : public IClock {
+public:
+    railway::Millis nowMs() const override {
+        return static_cast<railway::Millis>(nowUs() / 1000U);
+    }
+
+    railway::Micros nowUs() const override {
+        const auto now = std::chrono::steady_clock::now();
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+        if (us < 0) {
+            return 0;
+        }
+        return static_cast<railway::Micros>(us);
+    }
+
+    std::uint64_t nowTicks() const override {
+        const auto ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+        return static_cast<std::uint64_t>(ticks);
+    }
+
+    std::uint64_t ticksPerSecond() const override {
+        using Period = std::chrono::steady_clock::period;
+        return static_cast<std::uint64_t>(Period::den / Period::num);
+    }
+};
+
+} // namespace railway::hal
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "railway/hal/IClock.h"
+#include "railway/hal/ISleeper.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace railway::hal {
+
+// Host sleeper on a condition variable; the deadline is measured on `clock`.
+class ThreadSleeper final : public ISleeper {
+public:
+    explicit ThreadSleeper(const IClock& clock);
+
+    void sleepUntilMs(railway::Millis deadlineMs) override;
+    void wake() override;
+
+private:
+    const IClock& clock_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool woken_{false};
+};
+
+} // namespace railway::hal
@@ -7,4 +7,7 @@ namespace railway::logic {
 // Pure function to compute controller freshness based on timing.
 bool computeControllerFresh(railway::Millis lastTickMs, railway::Millis now, railway::Millis maxLoopGapMs);
 
+// Microsecond variant for loop-gap budgets below 1 ms. A zero lastTickUs means "no tick yet".
+bool computeControllerFreshUs(railway::Micros lastTickUs, railway::Micros now, railway::Micros maxLoopGapUs);
+
 } // namespace railway::logic
\ No newline at end of file
@@ -10,4 +10,8 @@ namespace railway::logic {
 Decision evaluateControllerLogic(Millis lastTickMs, Millis now, Millis maxLoopGapMs,
                                  bool ownTrackCircuitHealthy, bool ownBlockOccupied, bool downstreamBlockOccupied);
 
+// Same, with the freshness check done at microsecond resolution.
+Decision evaluateControllerLogicUs(Micros lastTickUs, Micros now, Micros maxLoopGapUs,
+                                   bool ownTrackCircuitHealthy, bool ownBlockOccupied, bool downstreamBlockOccupied);
+
 } // namespace railway::logic
\ No newline at end of file
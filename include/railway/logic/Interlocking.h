@@ -11,6 +11,8 @@ enum class StopReason : std::uint8_t {
     DownstreamStop = 2,
     TrackCircuitFault = 3,
     ControllerStale = 4,
+    // The signal's lamps did not prove the commanded aspect.
+    LampFailure = 5,
 };
 
 struct Inputs {
@@ -29,4 +31,9 @@ struct Decision {
 // Pure logic interlocking decision.
 Decision evaluate(const Inputs& in);
 
+// Applies the lamp proving result to `decision`: when the lamps failed to prove, the signal is
+// forced to Stop with LampFailure and health drops to at least Degraded. A stale controller
+// keeps its reason, since that failure is the more fundamental one.
+Decision applyLampProving(const Decision& decision, bool lampsProven);
+
 } // namespace railway::logic
@@ -0,0 +1,60 @@
+#include "railway/app/DemoScenario.h"
+
+#include <array>
+
+namespace railway::app {
+
+namespace {
+
+struct Change {
+    std::uint64_t atMs;
+    railway::hal::Pin pin;
+    railway::hal::PinLevel level;
+};
+
+// activeLow=true in TrackCircuitInput means: HIGH == clear, LOW == occupied/fault.
+// Sorted by time; the 0ms changes fire again at the start of every later period.
+constexpr std::array<Change, 7> kTimeline{{
+    {0, kDemoOwnTrackPin, railway::hal::PinLevel::High},
+    {0, kDemoDownstreamTrackPin, railway::hal::PinLevel::High},
+    {600, kDemoDownstreamTrackPin, railway::hal::PinLevel::Low},
+    {1300, kDemoOwnTrackPin, railway::hal::PinLevel::Low},
+    {1900, kDemoOwnTrackPin, railway::hal::PinLevel::High},
+    {2500, kDemoDownstreamTrackPin, railway::hal::PinLevel::High},
+    {3000, kDemoOwnTrackPin, railway::hal::PinLevel::Low},
+}};
+
+static_assert(kTimeline.back().atMs < kDemoScenarioPeriodMs, "scenario change scheduled past the period");
+
+} // namespace
+
+void startDemoScenario(railway::hal::MockGpio& mock) {
+    for (const Change& c : kTimeline) {
+        if (c.atMs == 0) {
+            mock.setInputLevel(c.pin, c.level);
+        }
+    }
+}
+
+void applyDemoScenario(railway::hal::MockGpio& mock, std::uint64_t afterMs, std::uint64_t throughMs) {
+    if (throughMs <= afterMs) {
+        return;
+    }
+    if (throughMs - afterMs > kDemoScenarioPeriodMs) {
+        afterMs = throughMs - kDemoScenarioPeriodMs;
+    }
+
+    // Offsets from the start of afterMs's period; the span crosses at most one period boundary.
+    const std::uint64_t from = afterMs % kDemoScenarioPeriodMs;
+    const std::uint64_t through = from + (throughMs - afterMs);
+    for (const std::uint64_t periodStart : {std::uint64_t{0}, kDemoScenarioPeriodMs}) {
+        for (const Change& c : kTimeline) {
+            const std::uint64_t at = periodStart + c.atMs;
+            if (at > from && at <= through) {
+                mock.setInputLevel(c.pin, c.level);
+            }
+        }
+    }
+}
+
+} // namespace railway::app
@@ -1,10 +1,14 @@
 #include "railway/app/BlockController.h"
+#include "railway/app/DemoScenario.h"
 #include "railway/drivers/SignalHead.h"
 #include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/InstrumentedGpio.h"
 #include "railway/hal/MockGpio.h"
 #include "railway/hal/PlatformHal.h"
+#include "railway/hal/ShadowGpio.h"
 
 #include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <thread>
 
@@ -18,6 +22,12 @@ const char* toString(railway::drivers::Aspect a) {
             return "CAUTION";
         case railway::drivers::Aspect::Clear:
             return "CLEAR";
+        case railway::drivers::Aspect::DoubleCaution:
+            return "DOUBLE CAUTION";
+        case railway::drivers::Aspect::FlashingCaution:
+            return "FLASHING CAUTION";
+        case railway::drivers::Aspect::FlashingDoubleCaution:
+            return "FLASHING DOUBLE CAUTION";
     }
     return "STOP";
 }
@@ -34,6 +44,8 @@ const char* toString(railway::logic::StopReason r) {
             return "TrackCircuitFault";
         case railway::logic::StopReason::ControllerStale:
             return "ControllerStale";
+        case railway::logic::StopReason::LampFailure:
+            return "LampFailure";
     }
     return "ControllerStale";
 }
@@ -47,37 +59,43 @@ int app_main() {
     // Host simulation hook: allow driving input pins.
     auto* mock = dynamic_cast<railway::hal::MockGpio*>(&gpio);
 
+    // Times every backend call when RAILWAY_GPIO_PROFILING is on; a plain forwarder otherwise.
+    railway::hal::InstrumentedGpio profiled(gpio, clock);
+
+    // Drivers write through a shadow register; redundant lamp writes never reach the backend
+    // and real changes go out once per tick in flush().
+    railway::hal::ShadowGpio outputs(profiled);
+
     railway::drivers::TrackCircuitInput::Config ownCfg;
-    ownCfg.pin = 2;
+    ownCfg.pin = railway::app::kDemoOwnTrackPin;
     ownCfg.activeLow = true;
     // Demo-friendly timing: short debounce and fault so you can observe state changes quickly.
     ownCfg.debounceMs = 50;
     ownCfg.stuckLowFaultMs = 800;
-    railway::drivers::TrackCircuitInput own(ownCfg, gpio);
+    railway::drivers::TrackCircuitInput own(ownCfg, outputs);
 
     railway::drivers::TrackCircuitInput::Config nextCfg;
-    nextCfg.pin = 3;
+    nextCfg.pin = railway::app::kDemoDownstreamTrackPin;
     nextCfg.activeLow = true;
     nextCfg.debounceMs = 50;
     nextCfg.stuckLowFaultMs = 800;
-    railway::drivers::TrackCircuitInput next(nextCfg, gpio);
+    railway::drivers::TrackCircuitInput next(nextCfg, outputs);
 
     railway::drivers::SignalHead::Config sigCfg;
-    sigCfg.redPin = 10;
-    sigCfg.yellowPin = 11;
-    sigCfg.greenPin = 12;
+    sigCfg.redPin = railway::app::kDemoRedPin;
+    sigCfg.yellowPin = railway::app::kDemoYellowPin;
+    sigCfg.greenPin = railway::app::kDemoGreenPin;
     sigCfg.activeHigh = true;
-    railway::drivers::SignalHead signal(sigCfg, gpio);
+    railway::drivers::SignalHead signal(sigCfg, outputs);
 
     railway::app::BlockController::Config ctrlCfg;
     ctrlCfg.maxLoopGapMs = 200;
     railway::app::BlockController controller(ctrlCfg, clock, own, next, signal);
     controller.init();
+    outputs.flush();
 
     if (mock != nullptr) {
-        // activeLow=true in TrackCircuitInput means: HIGH == clear, LOW == occupied/fault.
-        mock->setInputLevel(2, railway::hal::PinLevel::High);
-        mock->setInputLevel(3, railway::hal::PinLevel::High);
+        railway::app::startDemoScenario(*mock);
     }
 
     auto lastAspect = controller.lastDecision().aspect;
@@ -88,32 +106,14 @@ int app_main() {
     for (int i = 0; i < 80; ++i) {
         const auto tMs = static_cast<int>(i * 50);
 
-        // Scenario timeline (host simulation only):
-        // - 0ms: both clear
-        // - 600ms: downstream becomes occupied -> CAUTION
-        // - 1300ms: own becomes occupied -> STOP
-        // - 1900ms: own clears again -> CAUTION
-        // - 2500ms: downstream clears -> CLEAR
-        // - 3000ms+: induce a track circuit "fault" by holding own not-clear long enough
-        if (mock != nullptr) {
-            if (tMs == 600) {
-                mock->setInputLevel(3, railway::hal::PinLevel::Low);
-            }
-            if (tMs == 1300) {
-                mock->setInputLevel(2, railway::hal::PinLevel::Low);
-            }
-            if (tMs == 1900) {
-                mock->setInputLevel(2, railway::hal::PinLevel::High);
-            }
-            if (tMs == 2500) {
-                mock->setInputLevel(3, railway::hal::PinLevel::High);
-            }
-            if (tMs == 3000) {
-                mock->setInputLevel(2, railway::hal::PinLevel::Low);
-            }
+        // Scenario timeline (host simulation only); see DemoScenario.h.
+        if (mock != nullptr && tMs > 0) {
+            railway::app::applyDemoScenario(*mock, static_cast<std::uint64_t>(tMs - 50),
+                                            static_cast<std::uint64_t>(tMs));
         }
 
         controller.tick();
+        outputs.flush();
 
         const auto d = controller.lastDecision();
         if (d.aspect != lastAspect || d.reason != lastReason) {
@@ -125,5 +125,15 @@ int app_main() {
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
 
+#if RAILWAY_GPIO_PROFILING
+    railway::hal::GpioLatencyStats stats[railway::hal::InstrumentedGpio::kMaxEntries];
+    const std::size_t n = profiled.exportStats(stats, railway::hal::InstrumentedGpio::kMaxEntries);
+    std::cout << "gpio profile (" << profiled.ticksPerSecond() << " ticks/s):\n";
+    for (std::size_t i = 0; i < n; ++i) {
+        std::cout << "  op=" << static_cast<int>(stats[i].op) << " key=" << stats[i].key << " calls=" << stats[i].calls
+                  << " total=" << stats[i].totalTicks << " max=" << stats[i].maxTicks << "\n";
+    }
+#endif
+
     return 0;
 }
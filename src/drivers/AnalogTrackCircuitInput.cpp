@@ -0,0 +1,27 @@
+#include "railway/drivers/AnalogTrackCircuitInput.h"
+
+namespace railway::drivers {
+
+std::uint32_t sumAdcSamples(const railway::hal::AdcSample* samples, std::size_t count) {
+    // Four independent accumulators: no dependency chain between neighbouring samples, which
+    // lets the loop vectorize and keeps an in-order MCU pipeline busy when it does not.
+    std::uint32_t s0 = 0;
+    std::uint32_t s1 = 0;
+    std::uint32_t s2 = 0;
+    std::uint32_t s3 = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        s0 += samples[i];
+        s1 += samples[i + 1];
+        s2 += samples[i + 2];
+        s3 += samples[i + 3];
+    }
+    for (; i < count; ++i) {
+        s0 += samples[i];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+template class BasicAnalogTrackCircuitInput<railway::hal::IAdc>;
+
+} // namespace railway::drivers
@@ -0,0 +1,7 @@
+#include "railway/drivers/AxleCounterSection.h"
+
+namespace railway::drivers {
+
+template class BasicAxleCounterSection<railway::hal::IGpio>;
+
+} // namespace railway::drivers
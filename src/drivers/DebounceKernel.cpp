@@ -0,0 +1,194 @@
+#include "railway/drivers/DebounceKernel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define RAILWAY_DEBOUNCE_AVX2 1
+#include <immintrin.h>
+#else
+#define RAILWAY_DEBOUNCE_AVX2 0
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define RAILWAY_DEBOUNCE_NEON 1
+#include <arm_neon.h>
+#else
+#define RAILWAY_DEBOUNCE_NEON 0
+#endif
+
+namespace railway::drivers {
+
+namespace {
+
+// Mirrors TrackCircuitInput::apply() for lane i.
+void updateLane(const DebounceLanes& l, std::size_t i, railway::Millis nowMs) {
+    if (l.newRawClear[i] != l.rawClear[i]) {
+        l.rawClear[i] = l.newRawClear[i];
+        l.lastRawChangeMs[i] = nowMs;
+    }
+    if ((nowMs - l.lastRawChangeMs[i]) >= l.debounceMs[i]) {
+        l.stableClear[i] = l.rawClear[i];
+    }
+    if (l.stableClear[i] == 0) {
+        if (l.stuckLowSinceMs[i] == 0) {
+            l.stuckLowSinceMs[i] = nowMs;
+        }
+        if ((nowMs - l.stuckLowSinceMs[i]) >= l.stuckLowFaultMs[i]) {
+            l.healthy[i] = 0;
+        }
+    } else {
+        l.stuckLowSinceMs[i] = 0;
+        l.healthy[i] = 1;
+    }
+}
+
+void updateScalar(const DebounceLanes& l, std::size_t begin, std::size_t count, railway::Millis nowMs) {
+    for (std::size_t i = begin; i < count; ++i) {
+        updateLane(l, i, nowMs);
+    }
+}
+
+#if RAILWAY_DEBOUNCE_AVX2
+#define RAILWAY_AVX2_INLINE __attribute__((target("avx2"), always_inline)) inline
+
+RAILWAY_AVX2_INLINE __m256i load8(const std::uint32_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+RAILWAY_AVX2_INLINE void store8(std::uint32_t* p, __m256i v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+// AVX2 has no unsigned 32-bit compare: a >= b exactly when max_epu32(a, b) == a.
+RAILWAY_AVX2_INLINE __m256i geU32(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi32(_mm256_max_epu32(a, b), a);
+}
+
+// Same dataflow as updateLane(), 8 lanes at a time, with every branch turned into a blend.
+__attribute__((target("avx2"))) void updateAvx2(const DebounceLanes& l, std::size_t count, railway::Millis nowMs) {
+    const __m256i now = _mm256_set1_epi32(static_cast<int>(nowMs));
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i in = load8(l.newRawClear + i);
+        const __m256i unchanged = _mm256_cmpeq_epi32(in, load8(l.rawClear + i));
+        const __m256i last = _mm256_blendv_epi8(now, load8(l.lastRawChangeMs + i), unchanged);
+
+        const __m256i settled = geU32(_mm256_sub_epi32(now, last), load8(l.debounceMs + i));
+        const __m256i stable = _mm256_blendv_epi8(load8(l.stableClear + i), in, settled);
+
+        const __m256i down = _mm256_cmpeq_epi32(stable, zero);
+        const __m256i oldSince = load8(l.stuckLowSinceMs + i);
+        const __m256i armed = _mm256_blendv_epi8(oldSince, now, _mm256_cmpeq_epi32(oldSince, zero));
+        const __m256i since = _mm256_and_si256(armed, down);
+
+        const __m256i fault = _mm256_and_si256(down, geU32(_mm256_sub_epi32(now, since), load8(l.stuckLowFaultMs + i)));
+        const __m256i keptHealthy = _mm256_andnot_si256(fault, load8(l.healthy + i));
+        const __m256i healthy = _mm256_blendv_epi8(one, keptHealthy, down);
+
+        store8(l.rawClear + i, in);
+        store8(l.lastRawChangeMs + i, last);
+        store8(l.stableClear + i, stable);
+        store8(l.stuckLowSinceMs + i, since);
+        store8(l.healthy + i, healthy);
+    }
+    updateScalar(l, i, count, nowMs);
+}
+#endif
+
+#if RAILWAY_DEBOUNCE_NEON
+void updateNeon(const DebounceLanes& l, std::size_t count, railway::Millis nowMs) {
+    const uint32x4_t now = vdupq_n_u32(nowMs);
+    const uint32x4_t zero = vdupq_n_u32(0);
+    const uint32x4_t one = vdupq_n_u32(1);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const uint32x4_t in = vld1q_u32(l.newRawClear + i);
+        const uint32x4_t unchanged = vceqq_u32(in, vld1q_u32(l.rawClear + i));
+        const uint32x4_t last = vbslq_u32(unchanged, vld1q_u32(l.lastRawChangeMs + i), now);
+
+        const uint32x4_t settled = vcgeq_u32(vsubq_u32(now, last), vld1q_u32(l.debounceMs + i));
+        const uint32x4_t stable = vbslq_u32(settled, in, vld1q_u32(l.stableClear + i));
+
+        const uint32x4_t down = vceqq_u32(stable, zero);
+        const uint32x4_t oldSince = vld1q_u32(l.stuckLowSinceMs + i);
+        const uint32x4_t armed = vbslq_u32(vceqq_u32(oldSince, zero), now, oldSince);
+        const uint32x4_t since = vandq_u32(armed, down);
+
+        const uint32x4_t fault = vandq_u32(down, vcgeq_u32(vsubq_u32(now, since), vld1q_u32(l.stuckLowFaultMs + i)));
+        const uint32x4_t keptHealthy = vbicq_u32(vld1q_u32(l.healthy + i), fault);
+        const uint32x4_t healthy = vbslq_u32(down, keptHealthy, one);
+
+        vst1q_u32(l.rawClear + i, in);
+        vst1q_u32(l.lastRawChangeMs + i, last);
+        vst1q_u32(l.stableClear + i, stable);
+        vst1q_u32(l.stuckLowSinceMs + i, since);
+        vst1q_u32(l.healthy + i, healthy);
+    }
+    updateScalar(l, i, count, nowMs);
+}
+#endif
+
+} // namespace
+
+void initDebounceLanes(const DebounceLanes& lanes, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        lanes.rawClear[i] = lanes.newRawClear[i];
+        lanes.stableClear[i] = lanes.newRawClear[i];
+        lanes.healthy[i] = 1;
+        lanes.lastRawChangeMs[i] = 0;
+        lanes.stuckLowSinceMs[i] = 0;
+    }
+}
+
+bool debounceKernelSupported(DebounceKernel kernel) {
+    switch (kernel) {
+        case DebounceKernel::Scalar:
+            return true;
+        case DebounceKernel::Avx2:
+#if RAILWAY_DEBOUNCE_AVX2
+            return __builtin_cpu_supports("avx2") != 0;
+#else
+            return false;
+#endif
+        case DebounceKernel::Neon:
+            return RAILWAY_DEBOUNCE_NEON != 0;
+    }
+    return false;
+}
+
+DebounceKernel bestDebounceKernel() {
+    static const DebounceKernel best = debounceKernelSupported(DebounceKernel::Avx2)   ? DebounceKernel::Avx2
+                                       : debounceKernelSupported(DebounceKernel::Neon) ? DebounceKernel::Neon
+                                                                                        : DebounceKernel::Scalar;
+    return best;
+}
+
+void updateDebounceLanes(const DebounceLanes& lanes, std::size_t count, railway::Millis nowMs) {
+    updateDebounceLanes(lanes, count, nowMs, bestDebounceKernel());
+}
+
+void updateDebounceLanes(const DebounceLanes& lanes, std::size_t count, railway::Millis nowMs,
+                         DebounceKernel kernel) {
+    if (!debounceKernelSupported(kernel)) {
+        kernel = DebounceKernel::Scalar;
+    }
+    switch (kernel) {
+#if RAILWAY_DEBOUNCE_AVX2
+        case DebounceKernel::Avx2:
+            updateAvx2(lanes, count, nowMs);
+            return;
+#endif
+#if RAILWAY_DEBOUNCE_NEON
+        case DebounceKernel::Neon:
+            updateNeon(lanes, count, nowMs);
+            return;
+#endif
+        default:
+            updateScalar(lanes, 0, count, nowMs);
+            return;
+    }
+}
+
+} // namespace railway::drivers
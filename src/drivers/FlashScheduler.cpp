@@ -0,0 +1,93 @@
+#include "railway/drivers/FlashScheduler.h"
+
+namespace railway::drivers {
+
+using railway::detail::bitOf;
+using railway::detail::lowestSetBit;
+
+FlashScheduler::FlashScheduler(const Arrays& arrays, std::size_t capacity, railway::Millis halfPeriodMs)
+    : a_(arrays),
+      capacity_(capacity),
+      words_(wordsFor(capacity)),
+      halfPeriodMs_(halfPeriodMs != 0 ? halfPeriodMs : 1),
+      nextChangeMs_(halfPeriodMs_) {}
+
+bool FlashScheduler::attach(IFlashTarget& target, std::size_t& slot) {
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        if (a_.targets[i] == nullptr) {
+            a_.targets[i] = &target;
+            a_.flashing[i / kBitsPerWord] &= ~bitOf(i);
+            slot = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FlashScheduler::detach(std::size_t slot) {
+    if (slot >= capacity_) {
+        return;
+    }
+    a_.targets[slot] = nullptr;
+    a_.flashing[slot / kBitsPerWord] &= ~bitOf(slot);
+}
+
+void FlashScheduler::setFlashing(std::size_t slot, bool flashing) {
+    if (slot >= capacity_ || a_.targets[slot] == nullptr) {
+        return;
+    }
+    if (flashing) {
+        a_.flashing[slot / kBitsPerWord] |= bitOf(slot);
+    } else {
+        a_.flashing[slot / kBitsPerWord] &= ~bitOf(slot);
+    }
+}
+
+bool FlashScheduler::isFlashing(std::size_t slot) const {
+    return slot < capacity_ && (a_.flashing[slot / kBitsPerWord] & bitOf(slot)) != 0;
+}
+
+bool FlashScheduler::phaseLit() const {
+    return lit_;
+}
+
+bool FlashScheduler::update(railway::Millis nowMs) {
+    bool lit = lit_;
+    if (!started_) {
+        // The first update anchors the phase to absolute time; from then on it advances by
+        // whole half-periods, so a wrap of the millisecond clock does not disturb it.
+        started_ = true;
+        lit = ((nowMs / halfPeriodMs_) & 1U) == 0;
+        nextChangeMs_ = (nowMs / halfPeriodMs_ + 1) * halfPeriodMs_;
+    } else if (!railway::isBefore(nowMs, nextChangeMs_)) {
+        const railway::Millis changes = (nowMs - nextChangeMs_) / halfPeriodMs_ + 1;
+        nextChangeMs_ += changes * halfPeriodMs_;
+        if ((changes & 1U) != 0) {
+            lit = !lit;
+        }
+    }
+    if (lit == lit_) {
+        return false;
+    }
+    lit_ = lit;
+    for (std::size_t w = 0; w < words_; ++w) {
+        for (std::uint64_t bits = a_.flashing[w]; bits != 0; bits &= bits - 1) {
+            a_.targets[w * kBitsPerWord + lowestSetBit(bits)]->onFlashPhase(lit);
+        }
+    }
+    return true;
+}
+
+railway::Millis FlashScheduler::nextChangeMs() const {
+    return nextChangeMs_;
+}
+
+railway::Millis FlashScheduler::halfPeriodMs() const {
+    return halfPeriodMs_;
+}
+
+std::size_t FlashScheduler::capacity() const {
+    return capacity_;
+}
+
+} // namespace railway::drivers
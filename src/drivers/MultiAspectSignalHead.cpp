@@ -0,0 +1,29 @@
+#include "railway/drivers/MultiAspectSignalHead.h"
+
+#include <algorithm>
+
+namespace railway::drivers {
+
+static_assert(FourAspectHead::kConflicts.size() <= MultiAspectSignalHeadConfig::kMaxConflicts,
+              "FourAspectHead has more conflict sets than the config holds");
+
+MultiAspectSignalHeadConfig fourAspectHeadConfig(railway::hal::Pin redPin,
+                                                 railway::hal::Pin yellowPin,
+                                                 railway::hal::Pin greenPin,
+                                                 railway::hal::Pin secondYellowPin,
+                                                 bool activeHigh) {
+    MultiAspectSignalHeadConfig cfg;
+    cfg.lampPins[0] = redPin;
+    cfg.lampPins[1] = yellowPin;
+    cfg.lampPins[2] = greenPin;
+    cfg.lampPins[3] = secondYellowPin;
+    cfg.lampCount = FourAspectHead::kLampCount;
+    cfg.activeHigh = activeHigh;
+    cfg.patterns = FourAspectHead::kPatterns;
+    std::copy(FourAspectHead::kConflicts.begin(), FourAspectHead::kConflicts.end(), cfg.conflicts.begin());
+    return cfg;
+}
+
+template class BasicMultiAspectSignalHead<railway::hal::IGpio>;
+
+} // namespace railway::drivers
@@ -0,0 +1,251 @@
+#include "railway/drivers/SignalBank.h"
+
+namespace railway::drivers {
+
+using railway::detail::bitOf;
+using railway::detail::lowestSetBit;
+
+namespace {
+
+using Tables = HeadTypeTables<ThreeAspectHead>;
+
+// Per-head level arrays only cover the aspects a three-lamp head can show.
+constexpr bool shownAspectsFitBank() {
+    for (const std::uint8_t shown : Tables::kShown) {
+        if (shown >= SignalBank::kAspectCount) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(shownAspectsFitBank(), "ThreeAspectHead shows an aspect SignalBank has no levels for");
+
+} // namespace
+
+SignalBank::SignalBank(const Arrays& arrays, std::size_t capacity, std::size_t portCapacity)
+    : a_(arrays),
+      capacity_(capacity),
+      words_(wordsFor(capacity)),
+      portCapacity_(portCapacity),
+      portWords_(wordsFor(portCapacity)) {}
+
+bool SignalBank::configure(std::size_t index, const SignalHeadConfig& cfg) {
+    if (index >= capacity_ || (a_.present[index / kBitsPerWord] & bitOf(index)) != 0) {
+        return false;
+    }
+
+    // Lamp order matches ThreeAspectHead: red, yellow, green. Proving inputs follow the lamps
+    // in the same order.
+    const std::array<railway::hal::Pin, 2 * kLampsPerHead> pins{
+        cfg.redPin, cfg.yellowPin, cfg.greenPin, cfg.redProvePin, cfg.yellowProvePin, cfg.greenProvePin};
+    const std::size_t pinCount = cfg.proving ? pins.size() : kLampsPerHead;
+
+    // Resolve port slots first so a rejected head leaves the bank untouched.
+    std::array<std::size_t, 2 * kLampsPerHead> slots{};
+    std::size_t newPorts = 0;
+    for (std::size_t p = 0; p < pinCount; ++p) {
+        const auto port = railway::hal::portOf(pins[p]);
+        const auto bit = railway::hal::maskOf(pins[p]);
+        for (std::size_t other = 0; other < p; ++other) {
+            if (pins[other] == pins[p]) {
+                return false;
+            }
+        }
+
+        std::size_t s = 0;
+        while (s < portCount_ && a_.ports[s].port != port) {
+            ++s;
+        }
+        if (s < portCount_) {
+            if (((a_.ports[s].mask | a_.ports[s].proveMask) & bit) != 0) {
+                return false;
+            }
+        } else {
+            // New port; pins of this head on the same new port share the slot.
+            std::size_t prior = 0;
+            while (prior < p && railway::hal::portOf(pins[prior]) != port) {
+                ++prior;
+            }
+            if (prior < p) {
+                s = slots[prior];
+            } else {
+                s = portCount_ + newPorts;
+                ++newPorts;
+            }
+        }
+        slots[p] = s;
+    }
+    if (portCount_ + newPorts > portCapacity_) {
+        return false;
+    }
+
+    for (std::size_t n = 0; n < newPorts; ++n) {
+        a_.ports[portCount_ + n] = PortState{};
+    }
+    HeadLamps head{};
+    for (std::size_t p = 0; p < pinCount; ++p) {
+        const std::size_t s = slots[p];
+        const std::size_t lamp = p % kLampsPerHead;
+        const bool prove = (p >= kLampsPerHead);
+        PortState& port = a_.ports[s];
+        port.port = railway::hal::portOf(pins[p]);
+
+        const auto bit = railway::hal::maskOf(pins[p]);
+        if (prove) {
+            port.proveMask |= bit;
+        } else {
+            port.mask |= bit;
+            if (cfg.activeHigh) {
+                port.activeHigh |= bit;
+            }
+        }
+
+        const LampLevelTable& levels = Tables::levels(prove ? cfg.provingActiveHigh : cfg.activeHigh);
+        auto& groups = prove ? head.proveGroups : head.groups;
+        std::uint8_t& groupCount = prove ? head.proveGroupCount : head.groupCount;
+        std::size_t g = 0;
+        while (g < groupCount && groups[g].slot != s) {
+            ++g;
+        }
+        if (g == groupCount) {
+            groups[g].slot = static_cast<std::uint16_t>(s);
+            ++groupCount;
+        }
+        groups[g].mask |= bit;
+        for (std::size_t a = 0; a < kAspectCount; ++a) {
+            if (((levels[a] >> lamp) & 1U) != 0) {
+                groups[g].values[a] |= bit;
+            }
+        }
+    }
+    portCount_ += newPorts;
+    head.mismatchLimit = (cfg.provingMismatchLimit == 0) ? 1 : cfg.provingMismatchLimit;
+
+    a_.lamps[index] = head;
+    a_.aspects[index] = static_cast<std::uint8_t>(Aspect::Stop);
+    a_.present[index / kBitsPerWord] |= bitOf(index);
+    if (head.proveGroupCount != 0) {
+        a_.proving[index / kBitsPerWord] |= bitOf(index);
+    }
+    return true;
+}
+
+void SignalBank::setAspect(std::size_t index, Aspect aspect) {
+    if (index >= capacity_) {
+        return;
+    }
+    const std::size_t w = index / kBitsPerWord;
+    if ((a_.present[w] & bitOf(index)) == 0) {
+        return;
+    }
+    // Fail-safe: unknown values, aspects needing lamps this head lacks and heads with a lamp
+    // fault become STOP.
+    const bool faulted = (a_.lampFaults[w] & bitOf(index)) != 0;
+    const auto value = static_cast<std::uint8_t>(Tables::shown(faulted ? Aspect::Stop : aspect));
+    if (a_.aspects[index] != value) {
+        a_.aspects[index] = value;
+        a_.dirty[w] |= bitOf(index);
+    }
+}
+
+Aspect SignalBank::aspect(std::size_t index) const {
+    return (index < capacity_) ? static_cast<Aspect>(a_.aspects[index]) : Aspect::Stop;
+}
+
+bool SignalBank::lampsProven(std::size_t index) const {
+    return (index >= capacity_) || (a_.lampFaults[index / kBitsPerWord] & bitOf(index)) == 0;
+}
+
+void SignalBank::clearLampFault(std::size_t index) {
+    if (index >= capacity_) {
+        return;
+    }
+    a_.lampFaults[index / kBitsPerWord] &= ~bitOf(index);
+    a_.lamps[index].mismatches = 0;
+}
+
+std::size_t SignalBank::lampFaultCount() const {
+    std::size_t count = 0;
+    for (std::size_t w = 0; w < words_; ++w) {
+        for (std::uint64_t bits = a_.lampFaults[w]; bits != 0; bits &= bits - 1) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+std::size_t SignalBank::capacity() const {
+    return capacity_;
+}
+
+std::size_t SignalBank::portCount() const {
+    return portCount_;
+}
+
+void SignalBank::stage() {
+    for (std::size_t w = 0; w < words_; ++w) {
+        for (std::uint64_t bits = a_.dirty[w]; bits != 0; bits &= bits - 1) {
+            stageHead(w * kBitsPerWord + lowestSetBit(bits));
+        }
+        a_.dirty[w] = 0;
+    }
+}
+
+void SignalBank::stageHead(std::size_t index) {
+    const HeadLamps& head = a_.lamps[index];
+    if ((a_.lampFaults[index / kBitsPerWord] & bitOf(index)) != 0) {
+        a_.aspects[index] = static_cast<std::uint8_t>(Aspect::Stop);
+    }
+    const std::size_t aspect = a_.aspects[index];
+    const bool atomic = (head.groupCount == 1);
+
+    for (std::size_t g = 0; g < head.groupCount; ++g) {
+        const LampGroup& group = head.groups[g];
+        PortState& port = a_.ports[group.slot];
+        const railway::hal::PortMask value = group.values[aspect];
+        const railway::hal::PortMask changed = (port.image ^ value) & group.mask;
+        if (changed == 0) {
+            continue;
+        }
+        port.image = (port.image & ~group.mask) | value;
+        if (atomic) {
+            port.pendingAtomic |= changed;
+        } else {
+            // A bit is lit when its level matches its polarity.
+            const railway::hal::PortMask lit = ~(value ^ port.activeHigh);
+            port.pendingOn |= changed & lit;
+            port.pendingOff |= changed & ~lit;
+        }
+        a_.portDirty[group.slot / kBitsPerWord] |= bitOf(group.slot);
+    }
+}
+
+void SignalBank::proveHead(std::size_t index) {
+    HeadLamps& head = a_.lamps[index];
+    const std::size_t aspect = a_.aspects[index];
+    bool proven = true;
+    for (std::size_t g = 0; g < head.proveGroupCount; ++g) {
+        const LampGroup& group = head.proveGroups[g];
+        proven = proven && ((a_.ports[group.slot].proveLevels & group.mask) == group.values[aspect]);
+    }
+
+    if (proven) {
+        head.mismatches = 0;
+    } else if (++head.mismatches >= head.mismatchLimit) {
+        // Latched: the head shows Stop from the next flush() until clearLampFault().
+        const std::size_t w = index / kBitsPerWord;
+        a_.lampFaults[w] |= bitOf(index);
+        if (a_.aspects[index] != static_cast<std::uint8_t>(Aspect::Stop)) {
+            a_.aspects[index] = static_cast<std::uint8_t>(Aspect::Stop);
+            a_.dirty[w] |= bitOf(index);
+        }
+    }
+}
+
+void SignalBank::clearPending(PortState& port) {
+    port.pendingAtomic = 0;
+    port.pendingOff = 0;
+    port.pendingOn = 0;
+}
+
+} // namespace railway::drivers
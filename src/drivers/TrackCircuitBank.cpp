@@ -0,0 +1,123 @@
+#include "railway/drivers/TrackCircuitBank.h"
+
+namespace railway::drivers {
+
+using railway::detail::bitOf;
+using railway::detail::lowestSetBit;
+
+TrackCircuitBank::TrackCircuitBank(const Arrays& arrays, std::size_t capacity)
+    : a_(arrays), capacity_(capacity), words_(wordsFor(capacity)) {}
+
+bool TrackCircuitBank::configure(std::size_t index, const TrackCircuitConfig& cfg) {
+    if (index >= capacity_ || cfg.debounceMode != DebounceMode::Timer) {
+        return false;
+    }
+    const std::size_t w = index / kBitsPerWord;
+    const std::uint64_t bit = bitOf(index);
+    a_.present[w] |= bit;
+    // rawClear = level for activeLow circuits, !level otherwise.
+    a_.invert[w] = cfg.activeLow ? (a_.invert[w] & ~bit) : (a_.invert[w] | bit);
+    a_.debounceMs[index] = cfg.debounceMs;
+    a_.stuckLowFaultMs[index] = cfg.stuckLowFaultMs;
+    return true;
+}
+
+void TrackCircuitBank::init(const std::uint64_t* levels) {
+    for (std::size_t w = 0; w < words_; ++w) {
+        const std::uint64_t present = a_.present[w];
+        a_.raw[w] = (levels[w] ^ a_.invert[w]) & present;
+        a_.stable[w] = a_.raw[w];
+        a_.healthy[w] = present;
+        a_.armed[w] = 0;
+    }
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        a_.lastRawChangeMs[i] = 0;
+        a_.stuckLowSinceMs[i] = 0;
+    }
+}
+
+void TrackCircuitBank::update(railway::Millis nowMs, const std::uint64_t* levels) {
+    for (std::size_t w = 0; w < words_; ++w) {
+        const std::uint64_t present = a_.present[w];
+        if (present == 0) {
+            continue;
+        }
+        const std::size_t base = w * kBitsPerWord;
+        const std::uint64_t raw = (levels[w] ^ a_.invert[w]) & present;
+
+        // Raw edges restart the debounce window.
+        for (std::uint64_t bits = raw ^ a_.raw[w]; bits != 0; bits &= bits - 1) {
+            a_.lastRawChangeMs[base + lowestSetBit(bits)] = nowMs;
+        }
+        a_.raw[w] = raw;
+
+        // Debounce: only circuits whose raw level differs from the stable one can change.
+        std::uint64_t stable = a_.stable[w];
+        for (std::uint64_t bits = raw ^ stable; bits != 0; bits &= bits - 1) {
+            const std::size_t i = base + lowestSetBit(bits);
+            if ((nowMs - a_.lastRawChangeMs[i]) >= a_.debounceMs[i]) {
+                stable ^= bitOf(i);
+            }
+        }
+        a_.stable[w] = stable;
+
+        // Clear circuits: disarm the stuck-low timer and recover.
+        std::uint64_t healthy = a_.healthy[w] | stable;
+        a_.armed[w] &= ~stable;
+
+        // Not-clear circuits: arm the timer once (a zero timestamp counts as unarmed, exactly
+        // like TrackCircuitInput), then fault the ones that stayed down too long.
+        const std::uint64_t down = ~stable & present;
+        for (std::uint64_t bits = down & ~a_.armed[w]; bits != 0; bits &= bits - 1) {
+            a_.stuckLowSinceMs[base + lowestSetBit(bits)] = nowMs;
+        }
+        if (nowMs != 0) {
+            a_.armed[w] |= down;
+        }
+        for (std::uint64_t bits = down & healthy; bits != 0; bits &= bits - 1) {
+            const std::size_t i = base + lowestSetBit(bits);
+            if ((nowMs - a_.stuckLowSinceMs[i]) >= a_.stuckLowFaultMs[i]) {
+                healthy &= ~bitOf(i);
+            }
+        }
+        a_.healthy[w] = healthy;
+    }
+}
+
+std::uint64_t TrackCircuitBank::occupiedWord(std::size_t word) const {
+    return word < words_ ? (~a_.stable[word] & a_.present[word]) : 0;
+}
+
+std::uint64_t TrackCircuitBank::healthyWord(std::size_t word) const {
+    return word < words_ ? (a_.healthy[word] & a_.present[word]) : 0;
+}
+
+void TrackCircuitBank::copyOccupied(std::uint64_t* out) const {
+    for (std::size_t w = 0; w < words_; ++w) {
+        out[w] = occupiedWord(w);
+    }
+}
+
+void TrackCircuitBank::copyHealthy(std::uint64_t* out) const {
+    for (std::size_t w = 0; w < words_; ++w) {
+        out[w] = healthyWord(w);
+    }
+}
+
+bool TrackCircuitBank::isOccupied(std::size_t index) const {
+    return index < capacity_ && (occupiedWord(index / kBitsPerWord) & bitOf(index)) != 0;
+}
+
+bool TrackCircuitBank::isHealthy(std::size_t index) const {
+    return index < capacity_ && (healthyWord(index / kBitsPerWord) & bitOf(index)) != 0;
+}
+
+std::size_t TrackCircuitBank::capacity() const {
+    return capacity_;
+}
+
+std::size_t TrackCircuitBank::wordCount() const {
+    return words_;
+}
+
+} // namespace railway::drivers
@@ -0,0 +1,30 @@
+#include "railway/hal/ArduinoClock.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+namespace railway::hal {
+
+railway::Millis ArduinoClock::nowMs() const {
+#ifdef ARDUINO
+    return static_cast<railway::Millis>(::millis());
+#else
+    return 0;
+#endif
+}
+
+railway::Micros ArduinoClock::nowUs() const {
+#ifdef ARDUINO
+    const auto raw = static_cast<std::uint32_t>(::micros());
+    if (raw < lastMicros_) {
+        ++wraps_;
+    }
+    lastMicros_ = raw;
+    return (static_cast<railway::Micros>(wraps_) << 32) | raw;
+#else
+    return 0;
+#endif
+}
+
+} // namespace railway::hal
@@ -4,8 +4,48 @@
 #include <Arduino.h>
 #endif
 
+#if defined(ARDUINO) && defined(ARDUINO_ARCH_ESP32)
+#include <soc/gpio_reg.h>
+#endif
+
 namespace railway::hal {
 
+#ifdef ARDUINO
+namespace {
+
+struct EdgeSlot {
+    Pin pin{0};
+    Edge edges{Edge::Both};
+    IEdgeListener* volatile listener{nullptr};
+};
+
+EdgeSlot edgeSlots[ArduinoGpio::kMaxEdgePins];
+
+// attachInterrupt() takes a plain function without context, so each slot gets its own
+// trampoline.
+template <std::size_t Slot>
+void edgeTrampoline() {
+    EdgeSlot& slot = edgeSlots[Slot];
+    IEdgeListener* listener = slot.listener;
+    if (listener == nullptr) {
+        return;
+    }
+    const bool high = ::digitalRead(static_cast<int>(slot.pin)) == HIGH;
+    const Edge edge = high ? Edge::Rising : Edge::Falling;
+    if (includesEdge(slot.edges, edge)) {
+        listener->onEdge(EdgeEvent{slot.pin, edge, static_cast<railway::Millis>(::millis())});
+    }
+}
+
+using Trampoline = void (*)();
+constexpr Trampoline edgeTrampolines[ArduinoGpio::kMaxEdgePins] = {
+    &edgeTrampoline<0>, &edgeTrampoline<1>, &edgeTrampoline<2>, &edgeTrampoline<3>,
+    &edgeTrampoline<4>, &edgeTrampoline<5>, &edgeTrampoline<6>, &edgeTrampoline<7>,
+};
+
+} // namespace
+#endif
+
 void ArduinoGpio::configure(Pin pin, PinMode mode) {
 #ifdef ARDUINO
     switch (mode) {
@@ -43,4 +83,112 @@ void ArduinoGpio::write(Pin pin, PinLevel level) {
 #endif
 }
 
+PortMask ArduinoGpio::readPort(Port port, PortMask mask) const {
+#if defined(ARDUINO) && defined(ARDUINO_ARCH_ESP32)
+    // ESP32: logical ports map 1:1 onto the GPIO input registers, so one load latches every pin.
+    if (port == 0) {
+        return static_cast<PortMask>(REG_READ(GPIO_IN_REG)) & mask;
+    }
+#ifdef GPIO_IN1_REG
+    if (port == 1) {
+        return static_cast<PortMask>(REG_READ(GPIO_IN1_REG)) & mask;
+    }
+#endif
+#endif
+#ifdef ARDUINO
+    PortMask levels = 0;
+    for (std::size_t bit = 0; bit < kPinsPerPort; ++bit) {
+        const PortMask pinMask = PortMask{1} << bit;
+        if ((mask & pinMask) != 0 && ::digitalRead(static_cast<int>(pinOf(port, bit))) == HIGH) {
+            levels |= pinMask;
+        }
+    }
+    return levels;
+#else
+    (void)port;
+    (void)mask;
+    return 0;
+#endif
+}
+
+void ArduinoGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+#if defined(ARDUINO) && defined(ARDUINO_ARCH_ESP32)
+    // W1TC/W1TS change only the selected bits, so an ISR or the other core writing other pins
+    // of the port is never overwritten (a read-modify-write of GPIO_OUT could lose its
+    // change). Pins going Low are written first, matching the per-pin fallback below.
+    if (port == 0) {
+        REG_WRITE(GPIO_OUT_W1TC_REG, mask & ~value);
+        REG_WRITE(GPIO_OUT_W1TS_REG, mask & value);
+        return;
+    }
+#ifdef GPIO_OUT1_REG
+    if (port == 1) {
+        REG_WRITE(GPIO_OUT1_W1TC_REG, mask & ~value);
+        REG_WRITE(GPIO_OUT1_W1TS_REG, mask & value);
+        return;
+    }
+#endif
+#endif
+    for (std::size_t bit = 0; bit < kPinsPerPort; ++bit) {
+        const PortMask pinMask = PortMask{1} << bit;
+        if ((mask & pinMask) != 0 && (value & pinMask) == 0) {
+            write(pinOf(port, bit), PinLevel::Low);
+        }
+    }
+    for (std::size_t bit = 0; bit < kPinsPerPort; ++bit) {
+        const PortMask pinMask = PortMask{1} << bit;
+        if ((mask & pinMask) != 0 && (value & pinMask) != 0) {
+            write(pinOf(port, bit), PinLevel::High);
+        }
+    }
+}
+
+bool ArduinoGpio::subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) {
+#ifdef ARDUINO
+    const int irq = digitalPinToInterrupt(static_cast<int>(pin));
+    if (irq < 0) {
+        return false;
+    }
+
+    std::size_t free = kMaxEdgePins;
+    for (std::size_t i = 0; i < kMaxEdgePins; ++i) {
+        if (edgeSlots[i].listener != nullptr && edgeSlots[i].pin == pin) {
+            free = i;
+            break;
+        }
+        if (edgeSlots[i].listener == nullptr && free == kMaxEdgePins) {
+            free = i;
+        }
+    }
+    if (free == kMaxEdgePins) {
+        return false;
+    }
+
+    ::detachInterrupt(irq);
+    edgeSlots[free].pin = pin;
+    edgeSlots[free].edges = edges;
+    edgeSlots[free].listener = &listener;
+    ::attachInterrupt(irq, edgeTrampolines[free], CHANGE);
+    return true;
+#else
+    (void)pin;
+    (void)edges;
+    (void)listener;
+    return false;
+#endif
+}
+
+void ArduinoGpio::unsubscribeEdges(Pin pin) {
+#ifdef ARDUINO
+    for (auto& slot : edgeSlots) {
+        if (slot.listener != nullptr && slot.pin == pin) {
+            ::detachInterrupt(digitalPinToInterrupt(static_cast<int>(pin)));
+            slot.listener = nullptr;
+        }
+    }
+#else
+    (void)pin;
+#endif
+}
+
 } // namespace railway::hal
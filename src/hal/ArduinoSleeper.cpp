@@ -0,0 +1,62 @@
+#include "railway/hal/ArduinoSleeper.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#if defined(ARDUINO) && defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace railway::hal {
+
+void ArduinoSleeper::sleepUntilMs(railway::Millis deadlineMs) {
+#if defined(ARDUINO) && defined(ARDUINO_ARCH_ESP32)
+    // Blocks on the task notification for the whole remainder; the loop only repeats when the
+    // tick rounding returns a little before the deadline.
+    task_.store(static_cast<void*>(::xTaskGetCurrentTaskHandle()), std::memory_order_release);
+    while (!woken_.load(std::memory_order_acquire)) {
+        const auto now = static_cast<railway::Millis>(::millis());
+        if (!railway::isBefore(now, deadlineMs)) {
+            break;
+        }
+        TickType_t ticks = pdMS_TO_TICKS(deadlineMs - now);
+        if (ticks == 0) {
+            ticks = 1;
+        }
+        ::ulTaskNotifyTake(pdTRUE, ticks);
+    }
+#elif defined(ARDUINO)
+    // Bare AVR has no scheduler to block on: give the CPU back one millisecond at a time.
+    while (!woken_.load(std::memory_order_acquire) &&
+           railway::isBefore(static_cast<railway::Millis>(::millis()), deadlineMs)) {
+        ::delay(1);
+    }
+#else
+    (void)deadlineMs;
+#endif
+    woken_.store(false, std::memory_order_release);
+}
+
+void ArduinoSleeper::wake() {
+    woken_.store(true, std::memory_order_release);
+#if defined(ARDUINO) && defined(ARDUINO_ARCH_ESP32)
+    auto* task = static_cast<TaskHandle_t>(task_.load(std::memory_order_acquire));
+    if (task == nullptr) {
+        // Not slept yet; the flag alone makes the first sleep return.
+        return;
+    }
+    if (::xPortInIsrContext()) {
+        BaseType_t higherPriorityWoken = pdFALSE;
+        ::vTaskNotifyGiveFromISR(task, &higherPriorityWoken);
+        if (higherPriorityWoken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+    } else {
+        ::xTaskNotifyGive(task);
+    }
+#endif
+}
+
+} // namespace railway::hal
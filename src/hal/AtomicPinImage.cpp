@@ -0,0 +1,74 @@
+#include "railway/hal/AtomicPinImage.h"
+
+namespace railway::hal {
+
+namespace {
+
+constexpr std::size_t kPortsPerWord = AtomicPinImage::kPinsPerWord / kPinsPerPort;
+
+constexpr std::uint64_t bitOf(Pin pin) {
+    return std::uint64_t{1} << (pin % AtomicPinImage::kPinsPerWord);
+}
+
+} // namespace
+
+PinLevel AtomicPinImage::read(Pin pin) const {
+    return (levels[pin / kPinsPerWord].load(std::memory_order_acquire) & bitOf(pin)) != 0 ? PinLevel::High
+                                                                                         : PinLevel::Low;
+}
+
+void AtomicPinImage::setLevel(Pin pin, PinLevel level) {
+    auto& word = levels[pin / kPinsPerWord];
+    if (level == PinLevel::High) {
+        word.fetch_or(bitOf(pin), std::memory_order_release);
+    } else {
+        word.fetch_and(~bitOf(pin), std::memory_order_release);
+    }
+}
+
+PinMode AtomicPinImage::mode(Pin pin) const {
+    const std::size_t shift = (pin % kModesPerWord) * kModeBits;
+    return static_cast<PinMode>((modes[pin / kModesPerWord].load(std::memory_order_acquire) >> shift) & 0x3);
+}
+
+void AtomicPinImage::setMode(Pin pin, PinMode mode) {
+    const std::size_t shift = (pin % kModesPerWord) * kModeBits;
+    auto& word = modes[pin / kModesPerWord];
+    std::uint64_t current = word.load(std::memory_order_relaxed);
+    std::uint64_t next = 0;
+    do {
+        next = (current & ~(std::uint64_t{0x3} << shift)) | (static_cast<std::uint64_t>(mode) << shift);
+    } while (!word.compare_exchange_weak(current, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+PortMask AtomicPinImage::readPort(Port port, PortMask mask) const {
+    const std::size_t shift = (port % kPortsPerWord) * kPinsPerPort;
+    return static_cast<PortMask>(levelWord(port / kPortsPerWord) >> shift) & mask;
+}
+
+void AtomicPinImage::writeMasked(Port port, PortMask mask, PortMask value) {
+    const std::size_t shift = (port % kPortsPerWord) * kPinsPerPort;
+    setLevelWordMasked(port / kPortsPerWord, static_cast<std::uint64_t>(mask) << shift,
+                       static_cast<std::uint64_t>(value) << shift);
+}
+
+std::uint64_t AtomicPinImage::levelWord(std::size_t index) const {
+    if (index >= kLevelWords) {
+        return 0;
+    }
+    return levels[index].load(std::memory_order_acquire);
+}
+
+void AtomicPinImage::setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levelBits) {
+    if (index >= kLevelWords) {
+        return;
+    }
+    // Single CAS so observers never see part of a masked update.
+    auto& word = levels[index];
+    std::uint64_t current = word.load(std::memory_order_relaxed);
+    while (!word.compare_exchange_weak(current, (current & ~mask) | (levelBits & mask), std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace railway::hal
@@ -0,0 +1,51 @@
+#include "railway/hal/ConcurrentMockGpio.h"
+
+namespace railway::hal {
+
+void ConcurrentMockGpio::configure(Pin pin, PinMode mode) {
+    pins_.setMode(pin, mode);
+}
+
+PinLevel ConcurrentMockGpio::read(Pin pin) const {
+    return pins_.read(pin);
+}
+
+void ConcurrentMockGpio::write(Pin pin, PinLevel level) {
+    pins_.setLevel(pin, level);
+}
+
+PortMask ConcurrentMockGpio::readPort(Port port, PortMask mask) const {
+    return pins_.readPort(port, mask);
+}
+
+void ConcurrentMockGpio::readMany(const Pin* pins, std::size_t count, PinLevel* levels) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        levels[i] = pins_.read(pins[i]);
+    }
+}
+
+void ConcurrentMockGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+    pins_.writeMasked(port, mask, value);
+}
+
+void ConcurrentMockGpio::setInputLevel(Pin pin, PinLevel level) {
+    pins_.setLevel(pin, level);
+}
+
+PinMode ConcurrentMockGpio::mode(Pin pin) const {
+    return pins_.mode(pin);
+}
+
+std::uint64_t ConcurrentMockGpio::levelWord(std::size_t index) const {
+    return pins_.levelWord(index);
+}
+
+void ConcurrentMockGpio::setLevelWord(std::size_t index, std::uint64_t levels) {
+    pins_.setLevelWordMasked(index, ~std::uint64_t{0}, levels);
+}
+
+void ConcurrentMockGpio::setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levels) {
+    pins_.setLevelWordMasked(index, mask, levels);
+}
+
+} // namespace railway::hal
@@ -0,0 +1,48 @@
+#include "railway/hal/IGpio.h"
+
+namespace railway::hal {
+
+PortMask IGpio::readPort(Port port, PortMask mask) const {
+    PortMask levels = 0;
+    for (std::size_t bit = 0; bit < kPinsPerPort; ++bit) {
+        const PortMask pinMask = PortMask{1} << bit;
+        if ((mask & pinMask) != 0 && read(pinOf(port, bit)) == PinLevel::High) {
+            levels |= pinMask;
+        }
+    }
+    return levels;
+}
+
+void IGpio::readMany(const Pin* pins, std::size_t count, PinLevel* levels) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        levels[i] = read(pins[i]);
+    }
+}
+
+void IGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+    const PortMask low = mask & ~value;
+    const PortMask high = mask & value;
+    for (std::size_t bit = 0; bit < kPinsPerPort; ++bit) {
+        if ((low & (PortMask{1} << bit)) != 0) {
+            write(pinOf(port, bit), PinLevel::Low);
+        }
+    }
+    for (std::size_t bit = 0; bit < kPinsPerPort; ++bit) {
+        if ((high & (PortMask{1} << bit)) != 0) {
+            write(pinOf(port, bit), PinLevel::High);
+        }
+    }
+}
+
+bool IGpio::subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) {
+    (void)pin;
+    (void)edges;
+    (void)listener;
+    return false;
+}
+
+void IGpio::unsubscribeEdges(Pin pin) {
+    (void)pin;
+}
+
+} // namespace railway::hal
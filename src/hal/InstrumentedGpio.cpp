@@ -0,0 +1,162 @@
+#include "railway/hal/InstrumentedGpio.h"
+
+namespace railway::hal {
+
+namespace {
+
+#if RAILWAY_GPIO_PROFILING
+std::size_t bucketOf(std::uint64_t ticks) {
+    std::size_t bucket = 0;
+    while (ticks != 0 && bucket < kLatencyBuckets - 1) {
+        ticks >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+void saturatingIncrement(std::uint32_t& counter) {
+    if (counter != UINT32_MAX) {
+        ++counter;
+    }
+}
+
+std::size_t slotOf(GpioOp op, std::uint16_t key) {
+    const std::uint32_t h = (static_cast<std::uint32_t>(key) * 2654435761u) ^ static_cast<std::uint32_t>(op);
+    return (h >> 16) % InstrumentedGpio::kMaxEntries;
+}
+#endif
+
+} // namespace
+
+InstrumentedGpio::InstrumentedGpio(IGpio& inner, const IClock& clock) : inner_(inner), clock_(clock) {}
+
+std::uint64_t InstrumentedGpio::begin() const {
+#if RAILWAY_GPIO_PROFILING
+    return clock_.nowTicks();
+#else
+    return 0;
+#endif
+}
+
+void InstrumentedGpio::end(GpioOp op, std::uint16_t key, std::uint64_t startTicks) const {
+#if RAILWAY_GPIO_PROFILING
+    const std::uint64_t elapsed = clock_.nowTicks() - startTicks;
+
+    std::size_t slot = slotOf(op, key);
+    for (std::size_t probe = 0; probe < kMaxEntries; ++probe, slot = (slot + 1) % kMaxEntries) {
+        GpioLatencyStats& e = entries_[slot];
+        if (!used_[slot]) {
+            used_[slot] = true;
+            e.op = op;
+            e.key = key;
+            ++entryCount_;
+        } else if (e.op != op || e.key != key) {
+            continue;
+        }
+        saturatingIncrement(e.calls);
+        e.totalTicks += elapsed;
+        if (elapsed > e.maxTicks) {
+            e.maxTicks = elapsed;
+        }
+        saturatingIncrement(e.buckets[bucketOf(elapsed)]);
+        return;
+    }
+    saturatingIncrement(untracked_);
+#else
+    (void)op;
+    (void)key;
+    (void)startTicks;
+#endif
+}
+
+void InstrumentedGpio::configure(Pin pin, PinMode mode) {
+    const auto t = begin();
+    inner_.configure(pin, mode);
+    end(GpioOp::Configure, pin, t);
+}
+
+PinLevel InstrumentedGpio::read(Pin pin) const {
+    const auto t = begin();
+    const PinLevel level = inner_.read(pin);
+    end(GpioOp::Read, pin, t);
+    return level;
+}
+
+void InstrumentedGpio::write(Pin pin, PinLevel level) {
+    const auto t = begin();
+    inner_.write(pin, level);
+    end(GpioOp::Write, pin, t);
+}
+
+PortMask InstrumentedGpio::readPort(Port port, PortMask mask) const {
+    const auto t = begin();
+    const PortMask levels = inner_.readPort(port, mask);
+    end(GpioOp::ReadPort, port, t);
+    return levels;
+}
+
+void InstrumentedGpio::readMany(const Pin* pins, std::size_t count, PinLevel* levels) const {
+    const auto t = begin();
+    inner_.readMany(pins, count, levels);
+    end(GpioOp::ReadMany, 0, t);
+}
+
+void InstrumentedGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+    const auto t = begin();
+    inner_.writeMasked(port, mask, value);
+    end(GpioOp::WriteMasked, port, t);
+}
+
+bool InstrumentedGpio::subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) {
+    return inner_.subscribeEdges(pin, edges, listener);
+}
+
+void InstrumentedGpio::unsubscribeEdges(Pin pin) {
+    inner_.unsubscribeEdges(pin);
+}
+
+std::size_t InstrumentedGpio::exportStats(GpioLatencyStats* out, std::size_t max) const {
+    std::size_t n = 0;
+#if RAILWAY_GPIO_PROFILING
+    for (std::size_t slot = 0; slot < kMaxEntries && n < max; ++slot) {
+        if (used_[slot]) {
+            out[n++] = entries_[slot];
+        }
+    }
+#else
+    (void)out;
+    (void)max;
+#endif
+    return n;
+}
+
+std::size_t InstrumentedGpio::entryCount() const {
+#if RAILWAY_GPIO_PROFILING
+    return entryCount_;
+#else
+    return 0;
+#endif
+}
+
+std::uint32_t InstrumentedGpio::untrackedCalls() const {
+#if RAILWAY_GPIO_PROFILING
+    return untracked_;
+#else
+    return 0;
+#endif
+}
+
+void InstrumentedGpio::reset() {
+#if RAILWAY_GPIO_PROFILING
+    entries_ = {};
+    used_ = {};
+    entryCount_ = 0;
+    untracked_ = 0;
+#endif
+}
+
+std::uint64_t InstrumentedGpio::ticksPerSecond() const {
+    return clock_.ticksPerSecond();
+}
+
+} // namespace railway::hal
@@ -0,0 +1,58 @@
+#include "railway/hal/MockAdc.h"
+
+namespace railway::hal {
+
+bool MockAdc::start(AdcChannel channel) {
+    if (channel >= kChannels) {
+        return false;
+    }
+    started_[channel] = true;
+    return true;
+}
+
+std::size_t MockAdc::read(AdcChannel channel, AdcSample* out, std::size_t max) {
+    if (channel >= kChannels) {
+        return 0;
+    }
+    return channels_[channel].popMany(out, max);
+}
+
+std::size_t MockAdc::inject(AdcChannel channel, const AdcSample* samples, std::size_t count) {
+    if (channel >= kChannels) {
+        return 0;
+    }
+    std::size_t pushed = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (channels_[channel].push(samples[i])) {
+            ++pushed;
+        }
+    }
+    return pushed;
+}
+
+std::size_t MockAdc::injectConstant(AdcChannel channel, AdcSample value, std::size_t count) {
+    if (channel >= kChannels) {
+        return 0;
+    }
+    std::size_t pushed = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (channels_[channel].push(value)) {
+            ++pushed;
+        }
+    }
+    return pushed;
+}
+
+bool MockAdc::isStarted(AdcChannel channel) const {
+    return channel < kChannels && started_[channel];
+}
+
+std::size_t MockAdc::pending(AdcChannel channel) const {
+    return (channel < kChannels) ? channels_[channel].size() : 0;
+}
+
+std::size_t MockAdc::overruns(AdcChannel channel) const {
+    return (channel < kChannels) ? channels_[channel].dropped() : 0;
+}
+
+} // namespace railway::hal
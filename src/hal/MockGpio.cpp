@@ -2,28 +2,169 @@
 
 namespace railway::hal {
 
+namespace {
+
+constexpr std::uint64_t bitOf(Pin pin) {
+    return std::uint64_t{1} << (pin % MockGpio::kPinsPerWord);
+}
+
+} // namespace
+
 void MockGpio::configure(Pin pin, PinMode mode) {
-    if (pin < kMaxPins) {
-        modes_[pin] = mode;
-    }
+    const std::size_t shift = (pin % kModesPerWord) * kModeBits;
+    auto& word = modes_[pin / kModesPerWord];
+    word = (word & ~(std::uint64_t{0x3} << shift)) | (static_cast<std::uint64_t>(mode) << shift);
+}
+
+PinMode MockGpio::mode(Pin pin) const {
+    const std::size_t shift = (pin % kModesPerWord) * kModeBits;
+    return static_cast<PinMode>((modes_[pin / kModesPerWord] >> shift) & 0x3);
 }
 
 PinLevel MockGpio::read(Pin pin) const {
-    if (pin < kMaxPins) {
-        return levels_[pin];
-    }
-    return PinLevel::Low;
+    return (levels_[pin / kPinsPerWord] & bitOf(pin)) != 0 ? PinLevel::High : PinLevel::Low;
 }
 
 void MockGpio::write(Pin pin, PinLevel level) {
-    if (pin < kMaxPins) {
-        levels_[pin] = level;
+    setLevel(pin, level);
+    if (journal_ != nullptr) {
+        record(pin, level, now());
+    }
+}
+
+PortMask MockGpio::readPort(Port port, PortMask mask) const {
+    static_assert(kPinsPerWord % kPinsPerPort == 0, "ports must not straddle level words");
+    constexpr std::size_t kPortsPerWord = kPinsPerWord / kPinsPerPort;
+
+    const std::size_t index = port / kPortsPerWord;
+    if (index >= kLevelWords) {
+        return 0;
+    }
+    const std::size_t shift = (port % kPortsPerWord) * kPinsPerPort;
+    return static_cast<PortMask>(levels_[index] >> shift) & mask;
+}
+
+void MockGpio::readMany(const Pin* pins, std::size_t count, PinLevel* levels) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        levels[i] = read(pins[i]);
+    }
+}
+
+void MockGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+    constexpr std::size_t kPortsPerWord = kPinsPerWord / kPinsPerPort;
+
+    const std::size_t index = port / kPortsPerWord;
+    const std::size_t shift = (port % kPortsPerWord) * kPinsPerPort;
+    setLevelWordMasked(index, static_cast<std::uint64_t>(mask) << shift, static_cast<std::uint64_t>(value) << shift);
+
+    if (journal_ != nullptr) {
+        const railway::Millis atMs = now();
+        for (std::size_t bit = 0; bit < kPinsPerPort; ++bit) {
+            const PortMask pinMask = PortMask{1} << bit;
+            if ((mask & pinMask) != 0) {
+                record(pinOf(port, bit), (value & pinMask) != 0 ? PinLevel::High : PinLevel::Low, atMs);
+            }
+        }
+    }
+}
+
+bool MockGpio::subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) {
+    for (std::size_t i = 0; i < subscriptionCount_; ++i) {
+        if (subscriptions_[i].pin == pin) {
+            subscriptions_[i] = EdgeSubscription{pin, edges, &listener};
+            return true;
+        }
+    }
+    if (subscriptionCount_ >= kMaxEdgeSubscriptions) {
+        return false;
+    }
+    subscriptions_[subscriptionCount_] = EdgeSubscription{pin, edges, &listener};
+    ++subscriptionCount_;
+    subscribed_[pin / kPinsPerWord] |= bitOf(pin);
+    return true;
+}
+
+void MockGpio::unsubscribeEdges(Pin pin) {
+    for (std::size_t i = 0; i < subscriptionCount_; ++i) {
+        if (subscriptions_[i].pin == pin) {
+            subscriptions_[i] = subscriptions_[subscriptionCount_ - 1];
+            --subscriptionCount_;
+            subscribed_[pin / kPinsPerWord] &= ~bitOf(pin);
+            return;
+        }
     }
 }
 
 void MockGpio::setInputLevel(Pin pin, PinLevel level) {
-    if (pin < kMaxPins) {
-        levels_[pin] = level;
+    setLevel(pin, level);
+}
+
+void MockGpio::setLevel(Pin pin, PinLevel level) {
+    const std::size_t index = pin / kPinsPerWord;
+    const std::uint64_t word = levels_[index];
+    storeWord(index, (level == PinLevel::High) ? (word | bitOf(pin)) : (word & ~bitOf(pin)));
+}
+
+void MockGpio::storeWord(std::size_t index, std::uint64_t levels) {
+    const std::uint64_t changed = (levels_[index] ^ levels) & subscribed_[index];
+    levels_[index] = levels;
+    if (changed != 0) {
+        notifyEdges(index, changed, levels);
+    }
+}
+
+void MockGpio::notifyEdges(std::size_t index, std::uint64_t changed, std::uint64_t levels) {
+    const railway::Millis atMs = now();
+    for (std::size_t bit = 0; bit < kPinsPerWord; ++bit) {
+        const std::uint64_t pinBit = std::uint64_t{1} << bit;
+        if ((changed & pinBit) == 0) {
+            continue;
+        }
+        const auto pin = static_cast<Pin>(index * kPinsPerWord + bit);
+        const Edge edge = (levels & pinBit) != 0 ? Edge::Rising : Edge::Falling;
+        for (std::size_t i = 0; i < subscriptionCount_; ++i) {
+            if (subscriptions_[i].pin == pin && includesEdge(subscriptions_[i].edges, edge)) {
+                subscriptions_[i].listener->onEdge(EdgeEvent{pin, edge, atMs});
+            }
+        }
+    }
+}
+
+void MockGpio::setClock(const IClock* clock) {
+    clock_ = clock;
+}
+
+void MockGpio::attachJournal(GpioJournal* journal) {
+    journal_ = journal;
+}
+
+railway::Millis MockGpio::now() const {
+    return (clock_ != nullptr) ? clock_->nowMs() : 0;
+}
+
+void MockGpio::record(Pin pin, PinLevel level, railway::Millis atMs) {
+    journal_->push(GpioWriteRecord{pin, level, atMs});
+}
+
+std::uint64_t MockGpio::levelWord(std::size_t index) const {
+    return (index < kLevelWords) ? levels_[index] : 0;
+}
+
+void MockGpio::setLevelWord(std::size_t index, std::uint64_t levels) {
+    if (index < kLevelWords) {
+        storeWord(index, levels);
+    }
+}
+
+void MockGpio::setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levels) {
+    if (index < kLevelWords) {
+        storeWord(index, (levels_[index] & ~mask) | (levels & mask));
+    }
+}
+
+void MockGpio::toggleLevelWord(std::size_t index, std::uint64_t mask) {
+    if (index < kLevelWords) {
+        storeWord(index, levels_[index] ^ mask);
     }
 }
 
@@ -0,0 +1,205 @@
+#include "railway/hal/NoisyGpio.h"
+
+namespace railway::hal {
+
+namespace {
+
+std::uint64_t splitMix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+std::uint64_t nextRandom(std::uint64_t& state) {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1Dull;
+}
+
+// Gap before the next glitch, uniform in [1, 2 * meanMs]. 64-bit so that 2 * meanMs cannot
+// wrap to a zero modulus.
+railway::Millis glitchGapMs(std::uint64_t& rng, railway::Millis meanMs) {
+    return static_cast<railway::Millis>(1U + nextRandom(rng) % (2ULL * meanMs));
+}
+
+// Wrap-safe "has `nowMs` reached `atMs`" for deadlines less than ~24 days away.
+bool reached(railway::Millis nowMs, railway::Millis atMs) {
+    return static_cast<std::int32_t>(nowMs - atMs) >= 0;
+}
+
+} // namespace
+
+NoisyGpio::NoisyGpio(IGpio& inner, const IClock& clock, std::uint64_t seed)
+    : inner_(inner), clock_(clock), seed_(seed) {}
+
+void NoisyGpio::configure(Pin pin, PinMode mode) {
+    inner_.configure(pin, mode);
+}
+
+PinLevel NoisyGpio::read(Pin pin) const {
+    const PinLevel level = inner_.read(pin);
+    NoisyPin* p = find(pin);
+    if (p == nullptr) {
+        return level;
+    }
+    return apply(*p, level == PinLevel::High, clock_.nowMs()) ? PinLevel::High : PinLevel::Low;
+}
+
+void NoisyGpio::write(Pin pin, PinLevel level) {
+    inner_.write(pin, level);
+}
+
+PortMask NoisyGpio::readPort(Port port, PortMask mask) const {
+    PortMask levels = inner_.readPort(port, mask);
+    const railway::Millis nowMs = clock_.nowMs();
+    for (auto& p : pins_) {
+        if (!p.used || portOf(p.pin) != port || (mask & maskOf(p.pin)) == 0) {
+            continue;
+        }
+        const bool level = apply(p, (levels & maskOf(p.pin)) != 0, nowMs);
+        levels = level ? (levels | maskOf(p.pin)) : (levels & ~maskOf(p.pin));
+    }
+    return levels;
+}
+
+void NoisyGpio::readMany(const Pin* pins, std::size_t count, PinLevel* levels) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        levels[i] = read(pins[i]);
+    }
+}
+
+void NoisyGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+    inner_.writeMasked(port, mask, value);
+}
+
+bool NoisyGpio::subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) {
+    return inner_.subscribeEdges(pin, edges, listener);
+}
+
+void NoisyGpio::unsubscribeEdges(Pin pin) {
+    inner_.unsubscribeEdges(pin);
+}
+
+bool NoisyGpio::setProfile(Pin pin, const NoiseProfile& profile) {
+    NoisyPin* p = find(pin);
+    for (std::size_t i = 0; p == nullptr && i < pins_.size(); ++i) {
+        if (!pins_[i].used) {
+            p = &pins_[i];
+        }
+    }
+    if (p == nullptr) {
+        return false;
+    }
+    p->pin = pin;
+    p->used = true;
+    p->profile = profile;
+    if (p->profile.bounceMs > kMaxBounceMs) {
+        p->profile.bounceMs = kMaxBounceMs;
+    }
+    if (p->profile.glitchMeanIntervalMs > kMaxGlitchIntervalMs) {
+        p->profile.glitchMeanIntervalMs = kMaxGlitchIntervalMs;
+    }
+    if (p->profile.glitchLengthMs > kMaxGlitchIntervalMs) {
+        p->profile.glitchLengthMs = kMaxGlitchIntervalMs;
+    }
+    restart(*p);
+    return true;
+}
+
+void NoisyGpio::clearProfile(Pin pin) {
+    NoisyPin* p = find(pin);
+    if (p != nullptr) {
+        *p = NoisyPin{};
+    }
+}
+
+void NoisyGpio::reseed(std::uint64_t seed) {
+    seed_ = seed;
+    corrupted_ = 0;
+    for (auto& p : pins_) {
+        if (p.used) {
+            restart(p);
+        }
+    }
+}
+
+std::uint64_t NoisyGpio::corruptedReads() const {
+    return corrupted_;
+}
+
+NoisyGpio::NoisyPin* NoisyGpio::find(Pin pin) const {
+    for (auto& p : pins_) {
+        if (p.used && p.pin == pin) {
+            return &p;
+        }
+    }
+    return nullptr;
+}
+
+void NoisyGpio::restart(NoisyPin& p) const {
+    // Per-pin stream, so one pin's read pattern never shifts another pin's noise. xorshift
+    // must not start from zero.
+    p.rng = splitMix64(seed_ ^ (static_cast<std::uint64_t>(p.pin) << 32));
+    if (p.rng == 0) {
+        p.rng = 1;
+    }
+    p.started = false;
+    p.bounceSlots = 0;
+}
+
+bool NoisyGpio::apply(NoisyPin& p, bool level, railway::Millis nowMs) const {
+    const NoiseProfile& prof = p.profile;
+
+    if (!p.started) {
+        p.started = true;
+        p.target = level;
+        p.targetSinceMs = nowMs;
+        p.visible = level;
+        p.visibleSinceMs = nowMs - kMaxBounceMs;
+        if (prof.glitchMeanIntervalMs != 0) {
+            p.nextGlitchMs = nowMs + glitchGapMs(p.rng, prof.glitchMeanIntervalMs);
+        }
+    }
+
+    // Slow edges: the visible level follows the backend level slowEdgeMs late.
+    if (level != p.target) {
+        p.target = level;
+        p.targetSinceMs = nowMs;
+    }
+    if (p.visible != p.target && reached(nowMs, p.targetSinceMs + prof.slowEdgeMs)) {
+        p.visible = p.target;
+        p.visibleSinceMs = p.targetSinceMs + prof.slowEdgeMs;
+        p.bounceSlots = prof.bounceMs != 0 ? nextRandom(p.rng) : 0;
+    }
+
+    bool observed = p.visible;
+
+    // Bounce: slot n of the pattern covers [n, n + 1) ms after the visible edge.
+    const railway::Millis sinceEdge = nowMs - p.visibleSinceMs;
+    if (sinceEdge < prof.bounceMs && ((p.bounceSlots >> sinceEdge) & 1) != 0) {
+        observed = !observed;
+    }
+
+    // Glitches: skip every pulse that already ended, drawing the next gap each time.
+    if (prof.glitchMeanIntervalMs != 0) {
+        while (reached(nowMs, p.nextGlitchMs + prof.glitchLengthMs)) {
+            p.nextGlitchMs += prof.glitchLengthMs + glitchGapMs(p.rng, prof.glitchMeanIntervalMs);
+        }
+        if (reached(nowMs, p.nextGlitchMs)) {
+            observed = !observed;
+        }
+    }
+
+    if (prof.stuck != StuckAt::None && reached(nowMs, prof.stuckFromMs) && !reached(nowMs, prof.stuckUntilMs)) {
+        observed = (prof.stuck == StuckAt::High);
+    }
+
+    if (observed != level) {
+        ++corrupted_;
+    }
+    return observed;
+}
+
+} // namespace railway::hal
@@ -0,0 +1,39 @@
+#include "railway/hal/PinSnapshot.h"
+
+namespace railway::hal {
+
+bool PinSnapshot::watch(Pin pin) {
+    const Port port = portOf(pin);
+    for (std::size_t i = 0; i < count_; ++i) {
+        if (entries_[i].port == port) {
+            entries_[i].mask |= maskOf(pin);
+            return true;
+        }
+    }
+    if (count_ >= kMaxPorts) {
+        return false;
+    }
+    entries_[count_] = Entry{port, maskOf(pin), 0};
+    ++count_;
+    return true;
+}
+
+void PinSnapshot::clear() {
+    count_ = 0;
+}
+
+PinLevel PinSnapshot::level(Pin pin) const {
+    const Port port = portOf(pin);
+    for (std::size_t i = 0; i < count_; ++i) {
+        if (entries_[i].port == port) {
+            return (entries_[i].levels & maskOf(pin)) != 0 ? PinLevel::High : PinLevel::Low;
+        }
+    }
+    return PinLevel::Low;
+}
+
+std::size_t PinSnapshot::portCount() const {
+    return count_;
+}
+
+} // namespace railway::hal
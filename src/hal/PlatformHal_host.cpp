@@ -1,16 +1,52 @@
 #include "railway/hal/PlatformHal.h"
+#include "railway/hal/SharedMemoryGpio.h"
+
+#include <cstdio>
+#include <cstdlib>
 
 namespace railway::hal {
 
+namespace {
+
+// Set RAILWAY_GPIO_SHM=<shm name> to run against a shared-memory pin image driven by an
+// external simulator process instead of the in-process MockGpio. If the segment cannot be
+// opened the process exits: falling back to MockGpio would drive a pin image nobody sees.
+IGpio* sharedGpioFromEnvironment() {
+    const char* name = std::getenv("RAILWAY_GPIO_SHM");
+    if (name == nullptr || *name == '\0') {
+        return nullptr;
+    }
+    static SharedMemoryGpio shared;
+    if (!shared.isOpen() && !shared.open(name, true)) {
+        std::fprintf(stderr, "railway: cannot open shared GPIO segment '%s' (RAILWAY_GPIO_SHM)\n", name);
+        std::exit(EXIT_FAILURE);
+    }
+    return &shared;
+}
+
+} // namespace
+
 // Implementations are provided by host singletons.
 IGpio& gpio() {
-    extern IGpio& mockGpioSingleton();
-    return mockGpioSingleton();
+    static IGpio* const selected = sharedGpioFromEnvironment();
+    if (selected != nullptr) {
+        return *selected;
+    }
+    return platformGpio();
 }
 
 IClock& clock() {
+    return platformClock();
+}
+
+PlatformGpio& platformGpio() {
+    extern IGpio& mockGpioSingleton();
+    return static_cast<MockGpio&>(mockGpioSingleton());
+}
+
+PlatformClock& platformClock() {
     extern IClock& steadyClockSingleton();
-    return steadyClockSingleton();
+    return static_cast<SteadyClock&>(steadyClockSingleton());
 }
 
 } // namespace railway::hal
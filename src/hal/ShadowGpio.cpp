@@ -0,0 +1,119 @@
+#include "railway/hal/ShadowGpio.h"
+
+namespace railway::hal {
+
+namespace {
+
+std::uint32_t popCount(PortMask mask) {
+    std::uint32_t n = 0;
+    while (mask != 0) {
+        mask &= mask - 1;
+        ++n;
+    }
+    return n;
+}
+
+} // namespace
+
+static_assert(ShadowGpio::kMaxPorts <= 64, "touched-port set is a single 64-bit word");
+
+ShadowGpio::ShadowGpio(IGpio& inner) : inner_(inner) {}
+
+void ShadowGpio::configure(Pin pin, PinMode mode) {
+    inner_.configure(pin, mode);
+}
+
+PortMask ShadowGpio::pending(Port port) const {
+    const PortMask known = desiredKnown_[port];
+    return ((desired_[port] ^ sent_[port]) & known) | (known & ~sentKnown_[port]);
+}
+
+PinLevel ShadowGpio::read(Pin pin) const {
+    const Port port = portOf(pin);
+    if (port < kMaxPorts && (pending(port) & maskOf(pin)) != 0) {
+        return (desired_[port] & maskOf(pin)) != 0 ? PinLevel::High : PinLevel::Low;
+    }
+    return inner_.read(pin);
+}
+
+void ShadowGpio::write(Pin pin, PinLevel level) {
+    writeMasked(portOf(pin), maskOf(pin), level == PinLevel::High ? maskOf(pin) : 0);
+}
+
+PortMask ShadowGpio::readPort(Port port, PortMask mask) const {
+    if (port >= kMaxPorts) {
+        return inner_.readPort(port, mask);
+    }
+    const PortMask shadowed = pending(port) & mask;
+    PortMask levels = (shadowed != mask) ? inner_.readPort(port, mask & ~shadowed) : 0;
+    return levels | (desired_[port] & shadowed);
+}
+
+void ShadowGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+    if (port >= kMaxPorts) {
+        inner_.writeMasked(port, mask, value);
+        return;
+    }
+
+    const PortMask redundant = mask & desiredKnown_[port] & ~(desired_[port] ^ value);
+    suppressed_ += popCount(redundant);
+
+    desired_[port] = (desired_[port] & ~mask) | (value & mask);
+    desiredKnown_[port] |= mask;
+    touchedPorts_ |= std::uint64_t{1} << port;
+}
+
+bool ShadowGpio::subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) {
+    return inner_.subscribeEdges(pin, edges, listener);
+}
+
+void ShadowGpio::unsubscribeEdges(Pin pin) {
+    inner_.unsubscribeEdges(pin);
+}
+
+std::size_t ShadowGpio::flush() {
+    std::size_t writes = 0;
+    std::uint64_t ports = touchedPorts_;
+    touchedPorts_ = 0;
+    for (std::size_t port = 0; ports != 0; ++port, ports >>= 1) {
+        if ((ports & 1) == 0) {
+            continue;
+        }
+        const auto p = static_cast<Port>(port);
+        const PortMask dirty = pending(p);
+        if (dirty == 0) {
+            continue;
+        }
+        inner_.writeMasked(p, dirty, desired_[p]);
+        sent_[p] = (sent_[p] & ~dirty) | (desired_[p] & dirty);
+        sentKnown_[p] |= dirty;
+        ++writes;
+    }
+    flushed_ += static_cast<std::uint32_t>(writes);
+    return writes;
+}
+
+bool ShadowGpio::hasPendingWrites() const {
+    std::uint64_t ports = touchedPorts_;
+    for (std::size_t port = 0; ports != 0; ++port, ports >>= 1) {
+        if ((ports & 1) != 0 && pending(static_cast<Port>(port)) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::uint32_t ShadowGpio::suppressedWrites() const {
+    return suppressed_;
+}
+
+std::uint32_t ShadowGpio::flushedWrites() const {
+    return flushed_;
+}
+
+void ShadowGpio::resetCounters() {
+    suppressed_ = 0;
+    flushed_ = 0;
+}
+
+} // namespace railway::hal
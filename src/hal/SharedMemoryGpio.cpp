@@ -0,0 +1,168 @@
+#include "railway/hal/SharedMemoryGpio.h"
+
+#include "railway/hal/AtomicPinImage.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RAILWAY_HAS_POSIX_SHM 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define RAILWAY_HAS_POSIX_SHM 0
+#endif
+
+namespace railway::hal {
+
+namespace {
+
+constexpr std::uint32_t kLayoutMagic = 0x52475049; // "RGPI"
+constexpr std::uint32_t kLayoutVersion = 1;
+// How long open() waits for a concurrent creator to size and publish the segment (~100 ms).
+constexpr int kPublishRetries = 100;
+constexpr unsigned kPublishRetryUs = 1000;
+
+} // namespace
+
+// Placed at offset 0 of the segment. A freshly created segment is zero-filled by the OS,
+// which is a valid "all Low / all Input" image; `magic` is published last.
+struct SharedMemoryGpio::Layout {
+    std::atomic<std::uint32_t> magic;
+    std::uint32_t version;
+    AtomicPinImage pins;
+};
+
+SharedMemoryGpio::~SharedMemoryGpio() {
+    close();
+}
+
+bool SharedMemoryGpio::open(const char* name, bool create) {
+    close();
+#if RAILWAY_HAS_POSIX_SHM
+    const int fd = ::shm_open(name, create ? (O_RDWR | O_CREAT) : O_RDWR, 0660);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    const bool fresh = create && (st.st_size == 0);
+    if (fresh && ::ftruncate(fd, static_cast<off_t>(sizeof(Layout))) != 0) {
+        ::close(fd);
+        return false;
+    }
+    // Another process may have created the segment and not sized it yet.
+    for (int retry = 0; !fresh && st.st_size == 0 && retry < kPublishRetries; ++retry) {
+        ::usleep(kPublishRetryUs);
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+    }
+    if (!fresh && static_cast<std::size_t>(st.st_size) < sizeof(Layout)) {
+        ::close(fd);
+        return false;
+    }
+
+    void* mem = ::mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        return false;
+    }
+
+    auto* layout = static_cast<Layout*>(mem);
+    if (fresh) {
+        layout->version = kLayoutVersion;
+        layout->magic.store(kLayoutMagic, std::memory_order_release);
+    } else {
+        // ...or sized it and not published the layout yet.
+        std::uint32_t magic = layout->magic.load(std::memory_order_acquire);
+        for (int retry = 0; magic == 0 && retry < kPublishRetries; ++retry) {
+            ::usleep(kPublishRetryUs);
+            magic = layout->magic.load(std::memory_order_acquire);
+        }
+        if (magic != kLayoutMagic || layout->version != kLayoutVersion) {
+            ::munmap(mem, sizeof(Layout));
+            return false;
+        }
+    }
+
+    layout_ = layout;
+    return true;
+#else
+    (void)name;
+    (void)create;
+    return false;
+#endif
+}
+
+void SharedMemoryGpio::close() {
+#if RAILWAY_HAS_POSIX_SHM
+    if (layout_ != nullptr) {
+        ::munmap(layout_, sizeof(Layout));
+    }
+#endif
+    layout_ = nullptr;
+}
+
+bool SharedMemoryGpio::isOpen() const {
+    return layout_ != nullptr;
+}
+
+bool SharedMemoryGpio::remove(const char* name) {
+#if RAILWAY_HAS_POSIX_SHM
+    return ::shm_unlink(name) == 0;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+void SharedMemoryGpio::configure(Pin pin, PinMode mode) {
+    if (layout_ != nullptr) {
+        layout_->pins.setMode(pin, mode);
+    }
+}
+
+PinMode SharedMemoryGpio::mode(Pin pin) const {
+    return layout_ != nullptr ? layout_->pins.mode(pin) : PinMode::Input;
+}
+
+PinLevel SharedMemoryGpio::read(Pin pin) const {
+    return layout_ != nullptr ? layout_->pins.read(pin) : PinLevel::Low;
+}
+
+void SharedMemoryGpio::write(Pin pin, PinLevel level) {
+    setInputLevel(pin, level);
+}
+
+PortMask SharedMemoryGpio::readPort(Port port, PortMask mask) const {
+    return layout_ != nullptr ? layout_->pins.readPort(port, mask) : 0;
+}
+
+void SharedMemoryGpio::writeMasked(Port port, PortMask mask, PortMask value) {
+    if (layout_ != nullptr) {
+        layout_->pins.writeMasked(port, mask, value);
+    }
+}
+
+void SharedMemoryGpio::setInputLevel(Pin pin, PinLevel level) {
+    if (layout_ != nullptr) {
+        layout_->pins.setLevel(pin, level);
+    }
+}
+
+std::uint64_t SharedMemoryGpio::levelWord(std::size_t index) const {
+    return layout_ != nullptr ? layout_->pins.levelWord(index) : 0;
+}
+
+void SharedMemoryGpio::setLevelWordMasked(std::size_t index, std::uint64_t mask, std::uint64_t levels) {
+    if (layout_ != nullptr) {
+        layout_->pins.setLevelWordMasked(index, mask, levels);
+    }
+}
+
+} // namespace railway::hal
@@ -0,0 +1,29 @@
+#include "railway/hal/SimulatedClock.h"
+
+namespace railway::hal {
+
+SimulatedClock::SimulatedClock(railway::Micros startUs) : nowUs_(startUs) {}
+
+railway::Millis SimulatedClock::nowMs() const {
+    return static_cast<railway::Millis>(nowUs() / 1000U);
+}
+
+railway::Micros SimulatedClock::nowUs() const {
+    return nowUs_.load(std::memory_order_acquire);
+}
+
+void SimulatedClock::advanceUs(railway::Micros deltaUs) {
+    nowUs_.fetch_add(deltaUs, std::memory_order_acq_rel);
+}
+
+void SimulatedClock::advanceMs(railway::Millis deltaMs) {
+    advanceUs(static_cast<railway::Micros>(deltaMs) * 1000U);
+}
+
+void SimulatedClock::setUs(railway::Micros us) {
+    railway::Micros current = nowUs_.load(std::memory_order_relaxed);
+    while (us > current && !nowUs_.compare_exchange_weak(current, us, std::memory_order_acq_rel)) {
+    }
+}
+
+} // namespace railway::hal
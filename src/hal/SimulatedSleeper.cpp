@@ -0,0 +1,21 @@
+#include "railway/hal/SimulatedSleeper.h"
+
+namespace railway::hal {
+
+SimulatedSleeper::SimulatedSleeper(SimulatedClock& clock) : clock_(clock) {}
+
+void SimulatedSleeper::sleepUntilMs(railway::Millis deadlineMs) {
+    if (woken_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    const railway::Millis now = clock_.nowMs();
+    if (railway::isBefore(now, deadlineMs)) {
+        clock_.advanceMs(deadlineMs - now);
+    }
+}
+
+void SimulatedSleeper::wake() {
+    woken_.store(true, std::memory_order_release);
+}
+
+} // namespace railway::hal
@@ -0,0 +1,31 @@
+#include "railway/hal/ThreadSleeper.h"
+
+#include <chrono>
+
+namespace railway::hal {
+
+ThreadSleeper::ThreadSleeper(const IClock& clock) : clock_(clock) {}
+
+void ThreadSleeper::sleepUntilMs(railway::Millis deadlineMs) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Re-read the clock after every wakeup: the condition variable waits on steady_clock,
+    // which need not be the clock the deadline is expressed in.
+    while (!woken_) {
+        const railway::Millis now = clock_.nowMs();
+        if (!railway::isBefore(now, deadlineMs)) {
+            break;
+        }
+        cv_.wait_for(lock, std::chrono::milliseconds(deadlineMs - now));
+    }
+    woken_ = false;
+}
+
+void ThreadSleeper::wake() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        woken_ = true;
+    }
+    cv_.notify_one();
+}
+
+} // namespace railway::hal
@@ -9,4 +9,11 @@ bool computeControllerFresh(railway::Millis lastTickMs, railway::Millis now, rai
     return (now - lastTickMs) <= maxLoopGapMs;
 }
 
+bool computeControllerFreshUs(railway::Micros lastTickUs, railway::Micros now, railway::Micros maxLoopGapUs) {
+    if (lastTickUs == 0) {
+        return true;
+    }
+    return (now - lastTickUs) <= maxLoopGapUs;
+}
+
 } // namespace railway::logic
\ No newline at end of file
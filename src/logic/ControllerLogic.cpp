@@ -3,10 +3,10 @@
 
 namespace railway::logic {
 
-Decision evaluateControllerLogic(Millis lastTickMs, Millis now, Millis maxLoopGapMs,
-                                 bool ownTrackCircuitHealthy, bool ownBlockOccupied, bool downstreamBlockOccupied) {
-    const bool fresh = computeControllerFresh(lastTickMs, now, maxLoopGapMs);
+namespace {
 
+Decision evaluateWithFreshness(bool fresh, bool ownTrackCircuitHealthy, bool ownBlockOccupied,
+                               bool downstreamBlockOccupied) {
     Inputs in{};
     in.controllerFresh = fresh;
     in.ownTrackCircuitHealthy = ownTrackCircuitHealthy;
@@ -16,4 +16,18 @@ Decision evaluateControllerLogic(Millis lastTickMs, Millis now, Millis maxLoopGa
     return evaluate(in);
 }
 
+} // namespace
+
+Decision evaluateControllerLogic(Millis lastTickMs, Millis now, Millis maxLoopGapMs,
+                                 bool ownTrackCircuitHealthy, bool ownBlockOccupied, bool downstreamBlockOccupied) {
+    const bool fresh = computeControllerFresh(lastTickMs, now, maxLoopGapMs);
+    return evaluateWithFreshness(fresh, ownTrackCircuitHealthy, ownBlockOccupied, downstreamBlockOccupied);
+}
+
+Decision evaluateControllerLogicUs(Micros lastTickUs, Micros now, Micros maxLoopGapUs,
+                                   bool ownTrackCircuitHealthy, bool ownBlockOccupied, bool downstreamBlockOccupied) {
+    const bool fresh = computeControllerFreshUs(lastTickUs, now, maxLoopGapUs);
+    return evaluateWithFreshness(fresh, ownTrackCircuitHealthy, ownBlockOccupied, downstreamBlockOccupied);
+}
+
 } // namespace railway::logic
\ No newline at end of file
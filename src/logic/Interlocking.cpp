@@ -41,4 +41,20 @@ Decision evaluate(const Inputs& in) {
     return out;
 }
 
+Decision applyLampProving(const Decision& decision, bool lampsProven) {
+    if (lampsProven) {
+        return decision;
+    }
+
+    Decision out = decision;
+    out.aspect = railway::drivers::Aspect::Stop;
+    if (decision.reason != StopReason::ControllerStale) {
+        out.reason = StopReason::LampFailure;
+    }
+    if (out.health == railway::Health::Ok) {
+        out.health = railway::Health::Degraded;
+    }
+    return out;
+}
+
 } // namespace railway::logic
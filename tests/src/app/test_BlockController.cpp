@@ -220,3 +220,374 @@ None
 */
 
 }  // namespace
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/app/BlockController.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/app/BlockController.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_snapshot {
+
+/* BlockController input sampling: one snapshot per tick */
+
+class CountingGpio final : public ::railway::hal::IGpio {
+public:
+    ::railway::hal::MockGpio backing;
+    mutable int readCalls{0};
+    mutable int readPortCalls{0};
+
+    void configure(::railway::hal::Pin pin, ::railway::hal::PinMode mode) override {
+        backing.configure(pin, mode);
+    }
+    ::railway::hal::PinLevel read(::railway::hal::Pin pin) const override {
+        ++readCalls;
+        return backing.read(pin);
+    }
+    void write(::railway::hal::Pin pin, ::railway::hal::PinLevel level) override {
+        backing.write(pin, level);
+    }
+    ::railway::hal::PortMask readPort(::railway::hal::Port port, ::railway::hal::PortMask mask) const override {
+        ++readPortCalls;
+        return backing.readPort(port, mask);
+    }
+};
+
+class TestClock final : public ::railway::hal::IClock {
+public:
+    ::railway::Millis now{0};
+    ::railway::Millis nowMs() const override { return now; }
+};
+
+class BlockControllerSnapshotTest : public ::testing::Test {
+protected:
+    CountingGpio gpio_;
+    TestClock clock_;
+    std::unique_ptr<::railway::drivers::TrackCircuitInput> own_;
+    std::unique_ptr<::railway::drivers::TrackCircuitInput> downstream_;
+    std::unique_ptr<::railway::drivers::SignalHead> signal_;
+    std::unique_ptr<::railway::app::BlockController> controller_;
+
+    void SetUp() override {
+        ::railway::drivers::TrackCircuitInput::Config ownCfg{};
+        ownCfg.pin = 2;
+        ownCfg.debounceMs = 0;
+        ::railway::drivers::TrackCircuitInput::Config downCfg{};
+        downCfg.pin = 40; // different port than the own circuit
+        downCfg.debounceMs = 0;
+        ::railway::drivers::SignalHead::Config sigCfg{};
+        sigCfg.redPin = 10;
+        sigCfg.yellowPin = 11;
+        sigCfg.greenPin = 12;
+
+        gpio_.backing.setInputLevel(2, ::railway::hal::PinLevel::High);
+        gpio_.backing.setInputLevel(40, ::railway::hal::PinLevel::High);
+
+        own_ = std::make_unique<::railway::drivers::TrackCircuitInput>(ownCfg, gpio_);
+        downstream_ = std::make_unique<::railway::drivers::TrackCircuitInput>(downCfg, gpio_);
+        signal_ = std::make_unique<::railway::drivers::SignalHead>(sigCfg, gpio_);
+        controller_ = std::make_unique<::railway::app::BlockController>(
+            ::railway::app::BlockController::Config{}, clock_, *own_, *downstream_, *signal_);
+        controller_->init();
+    }
+};
+
+TEST_F(BlockControllerSnapshotTest, Tick_SamplesEachInputPortOnceAndNoSinglePins) {
+    gpio_.readCalls = 0;
+    gpio_.readPortCalls = 0;
+
+    clock_.now = 10;
+    controller_->tick();
+
+    EXPECT_EQ(gpio_.readCalls, 0);
+    EXPECT_EQ(gpio_.readPortCalls, 2);
+    EXPECT_EQ(controller_->lastDecision().aspect, ::railway::drivers::Aspect::Clear);
+}
+
+TEST_F(BlockControllerSnapshotTest, Tick_SnapshotReflectsInputsAtSampleTime) {
+    gpio_.backing.setInputLevel(40, ::railway::hal::PinLevel::Low);
+
+    clock_.now = 10;
+    controller_->tick();
+
+    EXPECT_TRUE(downstream_->isOccupied());
+    EXPECT_EQ(controller_->lastDecision().aspect, ::railway::drivers::Aspect::Caution);
+}
+
+}  // namespace ai_test_section_snapshot
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/app/BlockController.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include "railway/app/BlockController.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_static_binding {
+
+/* BasicBlockController bound to concrete HAL types at compile time */
+
+// Non-virtual clock with the IClock surface the controller uses.
+struct ManualClock {
+    ::railway::Millis now{0};
+    ::railway::Millis nowMs() const { return now; }
+    ::railway::Micros nowUs() const { return static_cast<::railway::Micros>(now) * 1000U; }
+};
+
+using StaticController = ::railway::app::BasicBlockController<::railway::hal::MockGpio, ManualClock>;
+
+TEST(BlockControllerStaticBindingTest, Tick_MatchesVirtualControllerBehaviour) {
+    ::railway::hal::MockGpio gpio;
+    ManualClock clock;
+
+    StaticController::TrackCircuit::Config ownCfg{};
+    ownCfg.pin = 2;
+    ownCfg.debounceMs = 0;
+    StaticController::TrackCircuit::Config downCfg{};
+    downCfg.pin = 3;
+    downCfg.debounceMs = 0;
+    StaticController::Signal::Config sigCfg{};
+    sigCfg.redPin = 10;
+    sigCfg.yellowPin = 11;
+    sigCfg.greenPin = 12;
+
+    gpio.setInputLevel(2, ::railway::hal::PinLevel::High);
+    gpio.setInputLevel(3, ::railway::hal::PinLevel::Low);
+
+    StaticController::TrackCircuit own(ownCfg, gpio);
+    StaticController::TrackCircuit downstream(downCfg, gpio);
+    StaticController::Signal signal(sigCfg, gpio);
+    StaticController controller(StaticController::Config{}, clock, own, downstream, signal);
+    controller.init();
+
+    clock.now = 10;
+    controller.tick();
+
+    EXPECT_EQ(controller.lastDecision().aspect, ::railway::drivers::Aspect::Caution);
+    EXPECT_EQ(gpio.read(10), ::railway::hal::PinLevel::Low);
+    EXPECT_EQ(gpio.read(11), ::railway::hal::PinLevel::High);
+    EXPECT_EQ(gpio.read(12), ::railway::hal::PinLevel::Low);
+}
+
+}  // namespace ai_test_section_static_binding
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/app/BlockController.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/app/BlockController.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_micros {
+
+/* BlockController sub-millisecond loop-gap budget */
+
+class MicroClock final : public ::railway::hal::IClock {
+public:
+    ::railway::Micros us{0};
+    ::railway::Millis nowMs() const override { return static_cast<::railway::Millis>(us / 1000U); }
+    ::railway::Micros nowUs() const override { return us; }
+};
+
+TEST(BlockControllerMicrosTest, LoopGapAboveMicrosecondBudgetIsStale) {
+    auto gpio = std::make_unique<::railway::hal::MockGpio>();
+    MicroClock clock;
+    clock.us = 1000;
+
+    ::railway::drivers::TrackCircuitInput::Config ownCfg{};
+    ownCfg.pin = 2;
+    ownCfg.debounceMs = 0;
+    ::railway::drivers::TrackCircuitInput::Config downCfg{};
+    downCfg.pin = 3;
+    downCfg.debounceMs = 0;
+    ::railway::drivers::SignalHead::Config sigCfg{};
+    sigCfg.redPin = 10;
+    sigCfg.yellowPin = 11;
+    sigCfg.greenPin = 12;
+    gpio->setInputLevel(2, ::railway::hal::PinLevel::High);
+    gpio->setInputLevel(3, ::railway::hal::PinLevel::High);
+
+    ::railway::app::BlockController::Config cfg{};
+    cfg.maxLoopGapUs = 500;
+
+    ::railway::drivers::TrackCircuitInput own(ownCfg, *gpio);
+    ::railway::drivers::TrackCircuitInput downstream(downCfg, *gpio);
+    ::railway::drivers::SignalHead signal(sigCfg, *gpio);
+    ::railway::app::BlockController controller(cfg, clock, own, downstream, signal);
+    controller.init();
+
+    // 400 us gap: within budget.
+    clock.us = 1400;
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().aspect, ::railway::drivers::Aspect::Clear);
+
+    // 600 us gap: stale, even though the millisecond clock only moved by 1 ms.
+    clock.us = 2000;
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().reason, ::railway::logic::StopReason::ControllerStale);
+}
+
+}  // namespace ai_test_section_micros
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/app/BlockController.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/app/BlockController.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_deadlines {
+
+struct ManualClock {
+    ::railway::Millis now{0};
+    ::railway::Millis nowMs() const { return now; }
+    ::railway::Micros nowUs() const { return static_cast<::railway::Micros>(now) * 1000U; }
+};
+
+using Controller = ::railway::app::BasicBlockController<::railway::hal::MockGpio, ManualClock>;
+
+TEST(BlockControllerDeadlineTest, NextDeadlineIsWatchdogOrEarliestTrackDeadline) {
+    auto gpio = std::make_unique<::railway::hal::MockGpio>();
+    gpio->setInputLevel(2, ::railway::hal::PinLevel::High);
+    gpio->setInputLevel(3, ::railway::hal::PinLevel::High);
+    ManualClock clock;
+    clock.now = 1000;
+
+    Controller::TrackCircuit::Config ownCfg{};
+    ownCfg.pin = 2;
+    ownCfg.debounceMs = 50;
+    Controller::TrackCircuit::Config downCfg = ownCfg;
+    downCfg.pin = 3;
+    downCfg.debounceMs = 80;
+    Controller::Signal::Config sigCfg{};
+    sigCfg.redPin = 10;
+    sigCfg.yellowPin = 11;
+    sigCfg.greenPin = 12;
+    Controller::TrackCircuit own(ownCfg, *gpio);
+    Controller::TrackCircuit down(downCfg, *gpio);
+    Controller::Signal signal(sigCfg, *gpio);
+    Controller::Config cfg;
+    cfg.maxLoopGapMs = 200;
+    Controller controller(cfg, clock, own, down, signal);
+    controller.init();
+
+    // Watchdog wake-up at half the 200ms loop gap.
+    EXPECT_EQ(controller.nextDeadlineMs(), 1100u);
+
+    clock.now = 1100;
+    gpio->setInputLevel(3, ::railway::hal::PinLevel::Low);
+    controller.tick();
+    EXPECT_EQ(controller.nextDeadlineMs(), 1180u);
+
+    clock.now = 1120;
+    gpio->setInputLevel(2, ::railway::hal::PinLevel::Low);
+    controller.tick();
+    EXPECT_EQ(controller.nextDeadlineMs(), 1170u);
+    EXPECT_FALSE(controller.inputsEventDriven());
+}
+
+}  // namespace ai_test_section_deadlines
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/app/BlockController.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/app/BlockController.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_lamp_proving {
+
+struct ManualClock {
+    ::railway::Millis now{0};
+    ::railway::Millis nowMs() const { return now; }
+    ::railway::Micros nowUs() const { return static_cast<::railway::Micros>(now) * 1000U; }
+};
+
+using Controller = ::railway::app::BasicBlockController<::railway::hal::MockGpio, ManualClock>;
+
+TEST(BlockControllerLampProvingTest, UnprovenLampForcesStopWithLampFailure) {
+    using ::railway::hal::PinLevel;
+    auto gpio = std::make_unique<::railway::hal::MockGpio>();
+    gpio->setInputLevel(2, PinLevel::High);
+    gpio->setInputLevel(3, PinLevel::High);
+    ManualClock clock;
+    clock.now = 1000;
+
+    Controller::TrackCircuit::Config trackCfg{};
+    trackCfg.pin = 2;
+    Controller::TrackCircuit own(trackCfg, *gpio);
+    trackCfg.pin = 3;
+    Controller::TrackCircuit down(trackCfg, *gpio);
+    Controller::Signal::Config sigCfg{};
+    sigCfg.redPin = 10;
+    sigCfg.yellowPin = 11;
+    sigCfg.greenPin = 12;
+    sigCfg.proving = true;
+    sigCfg.redProvePin = 20;
+    sigCfg.yellowProvePin = 21;
+    sigCfg.greenProvePin = 22;
+    Controller::Signal signal(sigCfg, *gpio);
+    Controller controller(Controller::Config{}, clock, own, down, signal);
+    controller.init();
+
+    // Proving inputs copy the lamp outputs, except for a failed green lamp.
+    bool greenFailed = false;
+    auto followLamps = [&]() {
+        gpio->setInputLevel(20, gpio->read(10));
+        gpio->setInputLevel(21, gpio->read(11));
+        gpio->setInputLevel(22, greenFailed ? PinLevel::Low : gpio->read(12));
+    };
+
+    for (int i = 0; i < 20 && controller.lastDecision().aspect != ::railway::drivers::Aspect::Clear; ++i) {
+        followLamps();
+        clock.now += 10;
+        controller.tick();
+    }
+    ASSERT_EQ(controller.lastDecision().aspect, ::railway::drivers::Aspect::Clear);
+
+    greenFailed = true;
+    followLamps();
+    clock.now += 10;
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().aspect, ::railway::drivers::Aspect::Clear);
+
+    followLamps();
+    clock.now += 10;
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().aspect, ::railway::drivers::Aspect::Stop);
+    EXPECT_EQ(controller.lastDecision().reason, ::railway::logic::StopReason::LampFailure);
+    EXPECT_EQ(controller.lastDecision().health, ::railway::Health::Degraded);
+    EXPECT_EQ(gpio->read(10), PinLevel::High);
+}
+
+}  // namespace ai_test_section_lamp_proving
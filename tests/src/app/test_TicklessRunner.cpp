@@ -0,0 +1,179 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: include/railway/app/TicklessRunner.h
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/app/BlockController.h"
+#include "railway/app/TicklessRunner.h"
+#include "railway/hal/MockGpio.h"
+#include "railway/hal/SimulatedClock.h"
+#include "railway/hal/SimulatedSleeper.h"
+#include "railway/hal/SteadyClock.h"
+#include "railway/hal/ThreadSleeper.h"
+
+namespace ai_test_section_base {
+
+/* test_TicklessRunner.cpp – deadline-driven scheduling in virtual time */
+
+using namespace railway::hal;
+using Controller = railway::app::BasicBlockController<MockGpio, SimulatedClock>;
+using Runner = railway::app::TicklessRunner<Controller>;
+using railway::drivers::Aspect;
+
+class TicklessRunnerTest : public ::testing::Test {
+protected:
+    std::unique_ptr<MockGpio> gpio_ = std::make_unique<MockGpio>();
+    SimulatedClock clock_{1000000};
+    SimulatedSleeper sleeper_{clock_};
+
+    Controller::TrackCircuit::Config trackCfg(Pin pin, bool eventDriven) {
+        Controller::TrackCircuit::Config cfg;
+        cfg.pin = pin;
+        cfg.debounceMs = 50;
+        cfg.stuckLowFaultMs = 3000;
+        cfg.eventDriven = eventDriven;
+        return cfg;
+    }
+
+    Controller::Signal::Config signalCfg() {
+        Controller::Signal::Config cfg;
+        cfg.redPin = 10;
+        cfg.yellowPin = 11;
+        cfg.greenPin = 12;
+        return cfg;
+    }
+
+    void SetUp() override {
+        gpio_->setClock(&clock_);
+        gpio_->setInputLevel(2, PinLevel::High);
+        gpio_->setInputLevel(3, PinLevel::High);
+    }
+};
+
+TEST_F(TicklessRunnerTest, QuietLineOnlyWakesForLoopGapWatchdog) {
+    Controller::TrackCircuit own(trackCfg(2, true), *gpio_);
+    Controller::TrackCircuit next(trackCfg(3, true), *gpio_);
+    Controller::Signal signal(signalCfg(), *gpio_);
+    Controller controller(Controller::Config{}, clock_, own, next, signal);
+    controller.init();
+    Runner runner(Runner::Config{}, controller, clock_, sleeper_);
+    runner.init();
+
+    while (clock_.nowMs() < 1000 + 10000) {
+        runner.runOnce();
+        ASSERT_EQ(controller.lastDecision().reason, railway::logic::StopReason::None);
+    }
+    // One tick per half loop gap (100ms); a fixed 50ms loop would have ticked 200 times.
+    EXPECT_LE(runner.ticks(), 101u);
+    EXPECT_EQ(controller.lastDecision().aspect, Aspect::Clear);
+}
+
+TEST_F(TicklessRunnerTest, InputEdgeWakesRunnerAndDebounceDeadlineCompletesIt) {
+    Controller::TrackCircuit own(trackCfg(2, true), *gpio_);
+    Controller::TrackCircuit next(trackCfg(3, true), *gpio_);
+    Controller::Signal signal(signalCfg(), *gpio_);
+    Controller controller(Controller::Config{}, clock_, own, next, signal);
+    controller.init();
+    Runner runner(Runner::Config{}, controller, clock_, sleeper_);
+    runner.init();
+
+    runner.runOnce();
+    // The edge lands while the runner is "asleep": the next sleep returns immediately.
+    gpio_->setInputLevel(2, PinLevel::Low);
+    const railway::Millis edgeMs = clock_.nowMs();
+    const std::uint32_t ticksBefore = runner.ticks();
+
+    railway::Millis tickMs = 0;
+    while (controller.lastDecision().aspect != Aspect::Stop) {
+        tickMs = clock_.nowMs();
+        runner.runOnce();
+        ASSERT_LT(runner.ticks(), ticksBefore + 5);
+    }
+    // Accepted at the debounce deadline, not at the next watchdog tick.
+    EXPECT_EQ(tickMs - edgeMs, 50u);
+}
+
+TEST_F(TicklessRunnerTest, PollingInputsAreSampledAtPollPeriod) {
+    Controller::TrackCircuit own(trackCfg(2, false), *gpio_);
+    Controller::TrackCircuit next(trackCfg(3, false), *gpio_);
+    Controller::Signal signal(signalCfg(), *gpio_);
+    Controller controller(Controller::Config{}, clock_, own, next, signal);
+    controller.init();
+    Runner::Config cfg;
+    cfg.pollPeriodMs = 20;
+    Runner runner(cfg, controller, clock_, sleeper_);
+    runner.init();
+
+    EXPECT_FALSE(controller.inputsEventDriven());
+    const railway::Millis start = clock_.nowMs();
+    EXPECT_EQ(runner.runOnce(), start + 20);
+}
+
+TEST_F(TicklessRunnerTest, StuckLowFaultDeadlineIsHonoured) {
+    Controller::TrackCircuit own(trackCfg(2, true), *gpio_);
+    Controller::TrackCircuit next(trackCfg(3, true), *gpio_);
+    Controller::Signal signal(signalCfg(), *gpio_);
+    Controller::Config ctrlCfg;
+    ctrlCfg.maxLoopGapMs = 5000;
+    Controller controller(ctrlCfg, clock_, own, next, signal);
+    controller.init();
+    Runner::Config cfg;
+    cfg.maxSleepMs = 10000;
+    Runner runner(cfg, controller, clock_, sleeper_);
+    runner.init();
+
+    gpio_->setInputLevel(2, PinLevel::Low);
+    const railway::Millis edgeMs = clock_.nowMs();
+    railway::Millis tickMs = 0;
+    while (own.isHealthy()) {
+        tickMs = clock_.nowMs();
+        runner.runOnce();
+        ASSERT_LT(runner.ticks(), 10u);
+    }
+    // Occupied after 50ms debounce, faulted 3000ms later.
+    EXPECT_EQ(tickMs - edgeMs, 3050u);
+    EXPECT_EQ(controller.lastDecision().reason, railway::logic::StopReason::TrackCircuitFault);
+}
+
+// SimulatedSleeper wakes exactly at the deadline; a real sleeper wakes late by the scheduler
+// latency, which the watchdog deadline must leave room for.
+TEST(TicklessRunnerRealClockTest, IdleRunningOnRealSleeperNeverGoesStale) {
+    auto gpio = std::make_unique<MockGpio>();
+    gpio->setInputLevel(2, PinLevel::High);
+    gpio->setInputLevel(3, PinLevel::High);
+    SteadyClock clock;
+    ThreadSleeper sleeper(clock);
+
+    using RealController = railway::app::BasicBlockController<MockGpio, SteadyClock>;
+    RealController::TrackCircuit::Config trackCfg;
+    trackCfg.pin = 2;
+    trackCfg.debounceMs = 10;
+    trackCfg.eventDriven = true;
+    RealController::TrackCircuit own(trackCfg, *gpio);
+    trackCfg.pin = 3;
+    RealController::TrackCircuit next(trackCfg, *gpio);
+    RealController::Signal::Config signalCfg;
+    signalCfg.redPin = 10;
+    signalCfg.yellowPin = 11;
+    signalCfg.greenPin = 12;
+    RealController::Signal signal(signalCfg, *gpio);
+    RealController::Config ctrlCfg;
+    ctrlCfg.maxLoopGapMs = 60;
+    RealController controller(ctrlCfg, clock, own, next, signal);
+    controller.init();
+    railway::app::TicklessRunner<RealController> runner(Runner::Config{}, controller, clock, sleeper);
+    runner.init();
+
+    for (int i = 0; i < 40; ++i) {
+        runner.runOnce();
+        ASSERT_NE(controller.lastDecision().reason, railway::logic::StopReason::ControllerStale) << "tick " << i;
+    }
+    EXPECT_EQ(controller.lastDecision().aspect, Aspect::Clear);
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,249 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: include/railway/drivers/AnalogTrackCircuitInput.h
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "railway/app/BlockController.h"
+#include "railway/drivers/AnalogTrackCircuitInput.h"
+#include "railway/hal/MockAdc.h"
+#include "railway/hal/MockGpio.h"
+#include "railway/hal/SimulatedClock.h"
+
+namespace ai_test_section_base {
+
+/* test_AnalogTrackCircuitInput.cpp – decimating fixed-point filter with hysteresis */
+
+using railway::drivers::AnalogTrackCircuitConfig;
+using railway::drivers::BasicAnalogTrackCircuitInput;
+using railway::hal::AdcSample;
+using railway::hal::MockAdc;
+using Input = BasicAnalogTrackCircuitInput<MockAdc>;
+
+constexpr railway::hal::AdcChannel kChannel = 1;
+constexpr AdcSample kEnergized = 3300;
+constexpr AdcSample kShunted = 300;
+
+class AnalogTrackCircuitInputTest : public ::testing::Test {
+protected:
+    std::unique_ptr<MockAdc> adc_ = std::make_unique<MockAdc>();
+
+    AnalogTrackCircuitConfig config() {
+        AnalogTrackCircuitConfig cfg;
+        cfg.channel = kChannel;
+        return cfg;
+    }
+
+    // 1 kHz sampling: `ms` samples at `level`, then one update().
+    void run(Input& input, railway::Millis& nowMs, AdcSample level, railway::Millis ms) {
+        adc_->injectConstant(kChannel, level, ms);
+        nowMs += ms;
+        input.update(nowMs);
+    }
+};
+
+TEST_F(AnalogTrackCircuitInputTest, SumMatchesNaiveLoopForAllTailLengths) {
+    std::vector<AdcSample> samples(67);
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = static_cast<AdcSample>(4095 - i * 37);
+    }
+    for (std::size_t count = 0; count <= samples.size(); ++count) {
+        std::uint32_t expected = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            expected += samples[i];
+        }
+        EXPECT_EQ(railway::drivers::sumAdcSamples(samples.data(), count), expected) << count;
+    }
+}
+
+TEST_F(AnalogTrackCircuitInputTest, StartsOccupiedAndClearsOnEnergizedLevel) {
+    Input input(config(), *adc_);
+    input.init();
+    EXPECT_TRUE(input.isOccupied());
+
+    railway::Millis now = 1000;
+    run(input, now, kEnergized, 50);
+    EXPECT_FALSE(input.isOccupied());
+    EXPECT_TRUE(input.isHealthy());
+    EXPECT_NEAR(input.filteredCounts(), kEnergized, 1);
+}
+
+TEST_F(AnalogTrackCircuitInputTest, ShuntIsDetectedAfterFilterSettles) {
+    Input input(config(), *adc_);
+    input.init();
+    railway::Millis now = 1000;
+    run(input, now, kEnergized, 100);
+
+    // One 16-sample group only moves the filter 1/8 of the way: still clear.
+    run(input, now, kShunted, 16);
+    EXPECT_FALSE(input.isOccupied());
+
+    run(input, now, kShunted, 200);
+    EXPECT_TRUE(input.isOccupied());
+    EXPECT_TRUE(input.isHealthy());
+
+    run(input, now, kShunted, 1000);
+    EXPECT_NEAR(input.filteredCounts(), kShunted, 1);
+}
+
+TEST_F(AnalogTrackCircuitInputTest, ShortSpikesAreFilteredOut) {
+    Input input(config(), *adc_);
+    input.init();
+    railway::Millis now = 1000;
+    run(input, now, kEnergized, 100);
+
+    // 4 ms dropouts to 0 V every 50 ms, e.g. a bouncing relay contact.
+    for (int i = 0; i < 20; ++i) {
+        run(input, now, 0, 4);
+        run(input, now, kEnergized, 46);
+        ASSERT_FALSE(input.isOccupied()) << i;
+    }
+}
+
+TEST_F(AnalogTrackCircuitInputTest, HysteresisHoldsStateBetweenThresholds) {
+    Input input(config(), *adc_);
+    input.init();
+    railway::Millis now = 1000;
+
+    // Between the thresholds from the start: stays occupied.
+    run(input, now, 2200, 200);
+    EXPECT_TRUE(input.isOccupied());
+
+    run(input, now, kEnergized, 200);
+    EXPECT_FALSE(input.isOccupied());
+
+    // Back between the thresholds: stays clear.
+    run(input, now, 2200, 200);
+    EXPECT_FALSE(input.isOccupied());
+}
+
+TEST_F(AnalogTrackCircuitInputTest, GroupsSpanningBlocksMatchOneLargeBlock) {
+    Input split(config(), *adc_);
+    split.init();
+    auto other = std::make_unique<MockAdc>();
+    BasicAnalogTrackCircuitInput<MockAdc> whole(config(), *other);
+    whole.init();
+
+    std::vector<AdcSample> samples(1000);
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = static_cast<AdcSample>((i * 7919) % 4000);
+    }
+
+    railway::Millis now = 0;
+    std::size_t offset = 0;
+    const std::size_t chunks[] = {1, 3, 15, 17, 64, 65, 200, 7};
+    for (std::size_t chunk : chunks) {
+        adc_->inject(kChannel, samples.data() + offset, chunk);
+        offset += chunk;
+        split.update(++now);
+    }
+    other->inject(kChannel, samples.data(), offset);
+    whole.update(now);
+
+    EXPECT_EQ(split.filteredCounts(), whole.filteredCounts());
+    EXPECT_EQ(split.isOccupied(), whole.isOccupied());
+}
+
+TEST_F(AnalogTrackCircuitInputTest, StuckLowBecomesFault) {
+    Input input(config(), *adc_);
+    input.init();
+    railway::Millis now = 1000;
+    run(input, now, kEnergized, 100);
+
+    for (int i = 0; i < 29; ++i) {
+        run(input, now, kShunted, 100);
+    }
+    EXPECT_TRUE(input.isHealthy());
+    for (int i = 0; i < 2; ++i) {
+        run(input, now, kShunted, 100);
+    }
+    EXPECT_FALSE(input.isHealthy());
+
+    run(input, now, kEnergized, 300);
+    EXPECT_TRUE(input.isHealthy());
+    EXPECT_FALSE(input.isOccupied());
+}
+
+TEST_F(AnalogTrackCircuitInputTest, OverRangeIsUnhealthyAndOccupied) {
+    Input input(config(), *adc_);
+    input.init();
+    railway::Millis now = 1000;
+    run(input, now, 4095, 50);
+
+    EXPECT_FALSE(input.isHealthy());
+    EXPECT_TRUE(input.isOccupied());
+}
+
+TEST_F(AnalogTrackCircuitInputTest, MissingSamplesAreUnhealthyUntilTheyResume) {
+    Input input(config(), *adc_);
+    input.init();
+    railway::Millis now = 1000;
+    run(input, now, kEnergized, 50);
+    ASSERT_FALSE(input.isOccupied());
+
+    railway::Millis deadline = 0;
+    ASSERT_TRUE(input.nextDeadlineMs(deadline));
+    EXPECT_EQ(deadline, now + 100);
+
+    input.update(now + 99);
+    EXPECT_TRUE(input.isHealthy());
+    input.update(now + 100);
+    EXPECT_FALSE(input.isHealthy());
+    EXPECT_TRUE(input.isOccupied());
+
+    now += 100;
+    run(input, now, kEnergized, 20);
+    EXPECT_TRUE(input.isHealthy());
+    EXPECT_FALSE(input.isOccupied());
+}
+
+TEST_F(AnalogTrackCircuitInputTest, UnknownChannelIsUnhealthy) {
+    AnalogTrackCircuitConfig cfg = config();
+    cfg.channel = static_cast<railway::hal::AdcChannel>(MockAdc::kChannels);
+    Input input(cfg, *adc_);
+    input.init();
+    input.update(10);
+
+    EXPECT_FALSE(input.isHealthy());
+    EXPECT_TRUE(input.isOccupied());
+}
+
+TEST_F(AnalogTrackCircuitInputTest, DrivesBlockControllerAsDownstreamTrack) {
+    using railway::hal::MockGpio;
+    using railway::hal::PinLevel;
+    using Controller = railway::app::BasicBlockController<MockGpio, railway::hal::SimulatedClock,
+                                                          railway::drivers::BasicTrackCircuitInput<MockGpio>, Input>;
+    railway::hal::SimulatedClock clock{1000000};
+    auto gpio = std::make_unique<MockGpio>();
+    gpio->setInputLevel(2, PinLevel::High);
+
+    Controller::TrackCircuit::Config ownCfg;
+    ownCfg.pin = 2;
+    Controller::TrackCircuit own(ownCfg, *gpio);
+    Input next(config(), *adc_);
+    Controller::Signal::Config signalCfg;
+    signalCfg.redPin = 10;
+    signalCfg.yellowPin = 11;
+    signalCfg.greenPin = 12;
+    Controller::Signal signal(signalCfg, *gpio);
+    Controller controller(Controller::Config{}, clock, own, next, signal);
+    controller.init();
+
+    adc_->injectConstant(kChannel, kEnergized, 50);
+    clock.advanceMs(50);
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().aspect, railway::drivers::Aspect::Clear);
+
+    adc_->injectConstant(kChannel, kShunted, 200);
+    clock.advanceMs(50);
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().aspect, railway::drivers::Aspect::Caution);
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,307 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: include/railway/drivers/AxleCounterSection.h
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/app/BlockController.h"
+#include "railway/drivers/AxleCounterSection.h"
+#include "railway/hal/MockGpio.h"
+#include "railway/hal/SimulatedClock.h"
+
+namespace ai_test_section_base {
+
+/* test_AxleCounterSection.cpp – quadrature counting heads fed through the pulse ring */
+
+using railway::drivers::AxleCounterFault;
+using railway::drivers::AxleDirection;
+using railway::drivers::BasicAxleCounterSection;
+using railway::drivers::StaticAxlePulseRing;
+using railway::hal::MockGpio;
+using railway::hal::Pin;
+using railway::hal::PinLevel;
+using Section = BasicAxleCounterSection<MockGpio>;
+
+constexpr Pin kHead0A = 4;
+constexpr Pin kHead0B = 5;
+constexpr Pin kHead1A = 6;
+constexpr Pin kHead1B = 7;
+
+class AxleCounterSectionTest : public ::testing::Test {
+protected:
+    std::unique_ptr<MockGpio> gpio_ = std::make_unique<MockGpio>();
+    StaticAxlePulseRing<1024> ring_;
+
+    Section::Config config() {
+        Section::Config cfg;
+        cfg.head0A = kHead0A;
+        cfg.head0B = kHead0B;
+        cfg.head1A = kHead1A;
+        cfg.head1B = kHead1B;
+        cfg.requireResetOnInit = false;
+        return cfg;
+    }
+
+    void SetUp() override {
+        // Active-low sensors: High means no wheel.
+        for (Pin pin : {kHead0A, kHead0B, kHead1A, kHead1B}) {
+            gpio_->setInputLevel(pin, PinLevel::High);
+        }
+    }
+
+    void wheel(Pin pin, bool present) {
+        gpio_->setInputLevel(pin, present ? PinLevel::Low : PinLevel::High);
+    }
+
+    // One axle crossing a head: `first` is covered first and released first.
+    void passAxle(Pin first, Pin second) {
+        wheel(first, true);
+        wheel(second, true);
+        wheel(first, false);
+        wheel(second, false);
+    }
+};
+
+TEST_F(AxleCounterSectionTest, CountsAxlesInAndOutWithDirection) {
+    Section section(config(), *gpio_, ring_);
+    section.init();
+    ASSERT_TRUE(section.isEventDriven());
+    ASSERT_TRUE(section.isHealthy());
+    EXPECT_FALSE(section.isOccupied());
+
+    for (int i = 0; i < 4; ++i) {
+        passAxle(kHead0A, kHead0B);
+    }
+    section.update(100);
+    EXPECT_TRUE(section.isOccupied());
+    EXPECT_EQ(section.axleCount(), 4u);
+    EXPECT_EQ(section.direction(), AxleDirection::Head0ToHead1);
+    EXPECT_EQ(section.lastAxleMs(), 100u);
+
+    // Leaving over head 1: B (inner) is reached first.
+    for (int i = 0; i < 3; ++i) {
+        passAxle(kHead1B, kHead1A);
+    }
+    section.update(200);
+    EXPECT_TRUE(section.isOccupied());
+    EXPECT_EQ(section.axleCount(), 1u);
+
+    passAxle(kHead1B, kHead1A);
+    section.update(300);
+    EXPECT_FALSE(section.isOccupied());
+    EXPECT_TRUE(section.isHealthy());
+    EXPECT_EQ(section.axlesIn(), 4u);
+    EXPECT_EQ(section.axlesOut(), 4u);
+    EXPECT_EQ(section.direction(), AxleDirection::None);
+}
+
+TEST_F(AxleCounterSectionTest, TrainBackingOutOverEntryHeadClearsSection) {
+    Section section(config(), *gpio_, ring_);
+    section.init();
+
+    passAxle(kHead1A, kHead1B);
+    passAxle(kHead1A, kHead1B);
+    section.update(10);
+    EXPECT_EQ(section.direction(), AxleDirection::Head1ToHead0);
+
+    passAxle(kHead1B, kHead1A);
+    passAxle(kHead1B, kHead1A);
+    section.update(20);
+    EXPECT_FALSE(section.isOccupied());
+    EXPECT_TRUE(section.isHealthy());
+}
+
+TEST_F(AxleCounterSectionTest, WheelRockingOnHeadCountsNothing) {
+    Section section(config(), *gpio_, ring_);
+    section.init();
+
+    // Covers A, reaches B, then rolls back off the way it came.
+    wheel(kHead0A, true);
+    wheel(kHead0B, true);
+    wheel(kHead0B, false);
+    wheel(kHead0A, false);
+    section.update(10);
+
+    EXPECT_FALSE(section.isOccupied());
+    EXPECT_TRUE(section.isHealthy());
+    EXPECT_EQ(section.axlesIn(), 0u);
+    EXPECT_EQ(section.axlesOut(), 0u);
+}
+
+TEST_F(AxleCounterSectionTest, LongTrainBurstBetweenTicksIsCountedInFull) {
+    Section section(config(), *gpio_, ring_);
+    section.init();
+
+    // 240 axles = 960 pulses queued before the next tick, far more than one batch.
+    for (int i = 0; i < 240; ++i) {
+        passAxle(kHead0A, kHead0B);
+    }
+    EXPECT_EQ(ring_.size(), 960u);
+    section.update(100);
+    EXPECT_EQ(ring_.size(), 0u);
+    EXPECT_EQ(section.axleCount(), 240u);
+    EXPECT_TRUE(section.isHealthy());
+}
+
+TEST_F(AxleCounterSectionTest, RingOverflowMakesSectionUnhealthyAndOccupied) {
+    StaticAxlePulseRing<16> small;
+    Section section(config(), *gpio_, small);
+    section.init();
+
+    for (int i = 0; i < 5; ++i) {
+        passAxle(kHead0A, kHead0B);
+    }
+    for (int i = 0; i < 5; ++i) {
+        passAxle(kHead1B, kHead1A);
+    }
+    section.update(100);
+
+    EXPECT_EQ(section.fault(), AxleCounterFault::Overflow);
+    EXPECT_FALSE(section.isHealthy());
+    EXPECT_TRUE(section.isOccupied());
+
+    section.reset();
+    EXPECT_TRUE(section.isHealthy());
+    EXPECT_FALSE(section.isOccupied());
+}
+
+TEST_F(AxleCounterSectionTest, MissedEdgeIsSequenceFault) {
+    Section section(config(), *gpio_, ring_);
+    section.init();
+
+    wheel(kHead0A, true);
+    wheel(kHead0B, true);
+    section.update(10);
+    ASSERT_TRUE(section.isHealthy());
+
+    // "A released" is lost; the next pulse reports A covered again.
+    railway::drivers::AxlePulse pulse;
+    pulse.sensor = railway::drivers::AxleSensor::Head0A;
+    pulse.wheelPresent = true;
+    pulse.atMs = 15;
+    ring_.push(pulse);
+    section.update(20);
+
+    EXPECT_EQ(section.fault(), AxleCounterFault::SensorSequence);
+    EXPECT_TRUE(section.isOccupied());
+}
+
+TEST_F(AxleCounterSectionTest, MoreAxlesOutThanInIsUnderflowFault) {
+    Section section(config(), *gpio_, ring_);
+    section.init();
+
+    passAxle(kHead0B, kHead0A);
+    section.update(10);
+
+    EXPECT_EQ(section.fault(), AxleCounterFault::CountUnderflow);
+    EXPECT_TRUE(section.isOccupied());
+}
+
+TEST_F(AxleCounterSectionTest, StartsDisturbedUntilResetByDefault) {
+    Section::Config cfg = config();
+    cfg.requireResetOnInit = true;
+    Section section(cfg, *gpio_, ring_);
+    section.init();
+    section.update(10);
+
+    EXPECT_EQ(section.fault(), AxleCounterFault::Disturbed);
+    EXPECT_TRUE(section.isOccupied());
+
+    section.reset();
+    section.update(20);
+    EXPECT_TRUE(section.isHealthy());
+    EXPECT_FALSE(section.isOccupied());
+}
+
+TEST_F(AxleCounterSectionTest, WheelStandingOnHeadAtResetCannotCountSilently) {
+    wheel(kHead0A, true);
+    Section section(config(), *gpio_, ring_);
+    section.init();
+    ASSERT_TRUE(section.isHealthy());
+
+    // The rest of the inbound walk: AB -> B -> 00 is only three quarter steps.
+    wheel(kHead0B, true);
+    wheel(kHead0A, false);
+    wheel(kHead0B, false);
+    section.update(10);
+
+    EXPECT_EQ(section.fault(), AxleCounterFault::Disturbed);
+    EXPECT_TRUE(section.isOccupied());
+}
+
+TEST_F(AxleCounterSectionTest, PulseBudgetLeavesRestQueuedAndDue) {
+    Section::Config cfg = config();
+    cfg.maxPulsesPerUpdate = 8;
+    Section section(cfg, *gpio_, ring_);
+    section.init();
+
+    for (int i = 0; i < 3; ++i) {
+        passAxle(kHead0A, kHead0B);
+    }
+    section.update(100);
+    EXPECT_EQ(section.axleCount(), 2u);
+
+    railway::Millis deadline = 0;
+    ASSERT_TRUE(section.nextDeadlineMs(deadline));
+    EXPECT_EQ(deadline, 100u);
+
+    section.update(105);
+    EXPECT_EQ(section.axleCount(), 3u);
+    EXPECT_FALSE(section.nextDeadlineMs(deadline));
+}
+
+TEST_F(AxleCounterSectionTest, BackendWithoutEdgesIsUnhealthy) {
+    class PollOnlyGpio final : public railway::hal::IGpio {
+    public:
+        void configure(Pin, railway::hal::PinMode) override {}
+        PinLevel read(Pin) const override { return PinLevel::High; }
+        void write(Pin, PinLevel) override {}
+    };
+    PollOnlyGpio gpio;
+    railway::drivers::AxleCounterSection section(config(), gpio, ring_);
+    section.init();
+
+    EXPECT_FALSE(section.isEventDriven());
+    EXPECT_EQ(section.fault(), AxleCounterFault::NoEdgeSupport);
+    section.reset();
+    EXPECT_TRUE(section.isOccupied());
+}
+
+TEST_F(AxleCounterSectionTest, DrivesBlockControllerAsOwnBlock) {
+    using Controller = railway::app::BasicBlockController<MockGpio, railway::hal::SimulatedClock, Section,
+                                                          railway::drivers::BasicTrackCircuitInput<MockGpio>>;
+    railway::hal::SimulatedClock clock{1000000};
+    gpio_->setInputLevel(3, PinLevel::High);
+
+    Section own(config(), *gpio_, ring_);
+    Controller::DownstreamTrackCircuit::Config nextCfg;
+    nextCfg.pin = 3;
+    Controller::DownstreamTrackCircuit next(nextCfg, *gpio_);
+    Controller::Signal::Config signalCfg;
+    signalCfg.redPin = 10;
+    signalCfg.yellowPin = 11;
+    signalCfg.greenPin = 12;
+    Controller::Signal signal(signalCfg, *gpio_);
+    Controller controller(Controller::Config{}, clock, own, next, signal);
+    controller.init();
+
+    clock.advanceMs(100);
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().aspect, railway::drivers::Aspect::Clear);
+
+    passAxle(kHead0A, kHead0B);
+    clock.advanceMs(50);
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().reason, railway::logic::StopReason::OwnBlockOccupied);
+
+    passAxle(kHead1B, kHead1A);
+    clock.advanceMs(50);
+    controller.tick();
+    EXPECT_EQ(controller.lastDecision().aspect, railway::drivers::Aspect::Clear);
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,127 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/DebounceKernel.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "railway/drivers/DebounceKernel.h"
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+#include "Lcg.h"
+
+namespace ai_test_section_base {
+
+/* test_DebounceKernel.cpp – vectorized debounce vs TrackCircuitInput */
+
+using railway::drivers::DebounceKernel;
+using railway::drivers::DebounceLanes;
+using railway::drivers::TrackCircuitConfig;
+using railway::drivers::TrackCircuitInput;
+using railway::hal::MockGpio;
+using railway::hal::Pin;
+using railway::hal::PinLevel;
+using railway::test::Lcg;
+
+// Not a multiple of the vector width, so the scalar tail runs too.
+constexpr std::size_t kLanes = 203;
+
+struct LaneArrays {
+    std::vector<std::uint32_t> in = std::vector<std::uint32_t>(kLanes);
+    std::vector<railway::Millis> debounce = std::vector<railway::Millis>(kLanes);
+    std::vector<railway::Millis> fault = std::vector<railway::Millis>(kLanes);
+    std::vector<std::uint32_t> raw = std::vector<std::uint32_t>(kLanes);
+    std::vector<std::uint32_t> stable = std::vector<std::uint32_t>(kLanes);
+    std::vector<std::uint32_t> healthy = std::vector<std::uint32_t>(kLanes);
+    std::vector<railway::Millis> lastChange = std::vector<railway::Millis>(kLanes);
+    std::vector<railway::Millis> since = std::vector<railway::Millis>(kLanes);
+
+    DebounceLanes view() {
+        return {in.data(),     debounce.data(),   fault.data(),      raw.data(),
+                stable.data(), healthy.data(),    lastChange.data(), since.data()};
+    }
+};
+
+void runDifferential(DebounceKernel kernel, std::uint32_t seed, railway::Millis startMs) {
+    auto gpio = std::make_unique<MockGpio>();
+    std::vector<std::unique_ptr<TrackCircuitInput>> reference(kLanes);
+    LaneArrays lanes;
+    LaneArrays scalar;
+    Lcg rng{seed};
+
+    for (std::size_t i = 0; i < kLanes; ++i) {
+        gpio->setInputLevel(static_cast<Pin>(i), rng.next(2) != 0 ? PinLevel::High : PinLevel::Low);
+        TrackCircuitConfig cfg;
+        cfg.pin = static_cast<Pin>(i);
+        cfg.activeLow = true;
+        cfg.debounceMs = rng.next(60);
+        cfg.stuckLowFaultMs = rng.next(400);
+        reference[i] = std::make_unique<TrackCircuitInput>(cfg, *gpio);
+        reference[i]->init();
+        lanes.debounce[i] = scalar.debounce[i] = cfg.debounceMs;
+        lanes.fault[i] = scalar.fault[i] = cfg.stuckLowFaultMs;
+    }
+
+    auto sample = [&] {
+        for (std::size_t i = 0; i < kLanes; ++i) {
+            lanes.in[i] = scalar.in[i] = gpio->read(static_cast<Pin>(i)) == PinLevel::High ? 1u : 0u;
+        }
+    };
+    sample();
+    railway::drivers::initDebounceLanes(lanes.view(), kLanes);
+    railway::drivers::initDebounceLanes(scalar.view(), kLanes);
+
+    railway::Millis now = startMs;
+    for (int tick = 0; tick < 2000; ++tick) {
+        for (int flips = static_cast<int>(rng.next(6)); flips > 0; --flips) {
+            const auto pin = static_cast<Pin>(rng.next(kLanes));
+            gpio->setInputLevel(pin, gpio->read(pin) == PinLevel::High ? PinLevel::Low : PinLevel::High);
+        }
+        sample();
+        railway::drivers::updateDebounceLanes(lanes.view(), kLanes, now, kernel);
+        railway::drivers::updateDebounceLanes(scalar.view(), kLanes, now, DebounceKernel::Scalar);
+
+        for (std::size_t i = 0; i < kLanes; ++i) {
+            reference[i]->update(now);
+            ASSERT_EQ(lanes.stable[i] == 0, reference[i]->isOccupied()) << "lane " << i << " tick " << tick;
+            ASSERT_EQ(lanes.healthy[i] != 0, reference[i]->isHealthy()) << "lane " << i << " tick " << tick;
+        }
+        ASSERT_EQ(lanes.raw, scalar.raw);
+        ASSERT_EQ(lanes.stable, scalar.stable);
+        ASSERT_EQ(lanes.healthy, scalar.healthy);
+        ASSERT_EQ(lanes.lastChange, scalar.lastChange);
+        ASSERT_EQ(lanes.since, scalar.since);
+        now += rng.next(30);
+    }
+}
+
+class DebounceKernelTest : public ::testing::TestWithParam<DebounceKernel> {};
+
+TEST_P(DebounceKernelTest, MatchesTrackCircuitInputFromTimeZero) {
+    if (!railway::drivers::debounceKernelSupported(GetParam())) {
+        GTEST_SKIP() << "kernel not available on this CPU";
+    }
+    runDifferential(GetParam(), 11, 0);
+}
+
+TEST_P(DebounceKernelTest, MatchesTrackCircuitInputAcrossMillisWrap) {
+    if (!railway::drivers::debounceKernelSupported(GetParam())) {
+        GTEST_SKIP() << "kernel not available on this CPU";
+    }
+    runDifferential(GetParam(), 12, 0xFFFFF000u);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllKernels, DebounceKernelTest,
+                         ::testing::Values(DebounceKernel::Scalar, DebounceKernel::Avx2, DebounceKernel::Neon));
+
+TEST(DebounceKernelDispatchTest, BestKernelIsSupportedAndScalarAlwaysIs) {
+    EXPECT_TRUE(railway::drivers::debounceKernelSupported(DebounceKernel::Scalar));
+    EXPECT_TRUE(railway::drivers::debounceKernelSupported(railway::drivers::bestDebounceKernel()));
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,122 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/FlashScheduler.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <vector>
+#include "railway/drivers/FlashScheduler.h"
+
+namespace ai_test_section_base {
+
+/* test_FlashScheduler.cpp – shared flash phase over a packed bitmap */
+
+using railway::drivers::FlashScheduler;
+using railway::drivers::IFlashTarget;
+using railway::drivers::StaticFlashScheduler;
+
+class RecordingTarget final : public IFlashTarget {
+public:
+    std::vector<bool> phases;
+    void onFlashPhase(bool lit) override {
+        phases.push_back(lit);
+    }
+};
+
+TEST(FlashSchedulerTest, PhaseFollowsAbsoluteTime) {
+    StaticFlashScheduler<4> scheduler(500);
+    EXPECT_TRUE(scheduler.phaseLit());
+
+    EXPECT_FALSE(scheduler.update(100));
+    EXPECT_TRUE(scheduler.phaseLit());
+    EXPECT_EQ(scheduler.nextChangeMs(), 500u);
+
+    EXPECT_TRUE(scheduler.update(500));
+    EXPECT_FALSE(scheduler.phaseLit());
+    EXPECT_FALSE(scheduler.update(999));
+    EXPECT_TRUE(scheduler.update(1000));
+    EXPECT_TRUE(scheduler.phaseLit());
+
+    // A skipped half-period leaves the phase where absolute time puts it.
+    EXPECT_FALSE(scheduler.update(2100));
+    EXPECT_TRUE(scheduler.phaseLit());
+}
+
+TEST(FlashSchedulerTest, MillisWrapKeepsSteadyRhythm) {
+    // 500 does not divide 2^32: absolute-time phase would jump at the wrap.
+    StaticFlashScheduler<4> scheduler(500);
+    RecordingTarget target;
+    std::size_t slot = 0;
+    ASSERT_TRUE(scheduler.attach(target, slot));
+    scheduler.setFlashing(slot, true);
+
+    railway::Millis now = 0xFFFFFFFFu - 2000u;
+    scheduler.update(now);
+    railway::Millis lastChange = 0;
+    bool haveChange = false;
+    for (int step = 0; step < 5000; ++step) {
+        now += 1;
+        if (scheduler.update(now)) {
+            if (haveChange) {
+                EXPECT_EQ(static_cast<railway::Millis>(now - lastChange), 500u) << "at " << now;
+            }
+            lastChange = now;
+            haveChange = true;
+            EXPECT_EQ(static_cast<railway::Millis>(scheduler.nextChangeMs() - now), 500u);
+        }
+    }
+    EXPECT_EQ(target.phases.size(), 10u);
+    for (std::size_t i = 1; i < target.phases.size(); ++i) {
+        EXPECT_NE(target.phases[i], target.phases[i - 1]);
+    }
+}
+
+TEST(FlashSchedulerTest, OnlyFlashingTargetsAreCalled) {
+    StaticFlashScheduler<130> scheduler(500);
+    std::vector<RecordingTarget> targets(130);
+    std::vector<std::size_t> slots(130);
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        ASSERT_TRUE(scheduler.attach(targets[i], slots[i]));
+    }
+    RecordingTarget extra;
+    std::size_t extraSlot = 0;
+    EXPECT_FALSE(scheduler.attach(extra, extraSlot));
+
+    scheduler.setFlashing(slots[3], true);
+    scheduler.setFlashing(slots[70], true);
+    scheduler.setFlashing(slots[129], true);
+    scheduler.setFlashing(slots[70], false);
+
+    scheduler.update(500);
+    scheduler.update(1000);
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        if (i == 3 || i == 129) {
+            EXPECT_EQ(targets[i].phases, (std::vector<bool>{false, true})) << i;
+        } else {
+            EXPECT_TRUE(targets[i].phases.empty()) << i;
+        }
+    }
+}
+
+TEST(FlashSchedulerTest, DetachedSlotIsReusedAndNotCalled) {
+    StaticFlashScheduler<2> scheduler(250);
+    RecordingTarget a;
+    RecordingTarget b;
+    std::size_t slotA = 0;
+    std::size_t slotB = 0;
+    ASSERT_TRUE(scheduler.attach(a, slotA));
+    scheduler.setFlashing(slotA, true);
+    scheduler.detach(slotA);
+    EXPECT_FALSE(scheduler.isFlashing(slotA));
+
+    ASSERT_TRUE(scheduler.attach(b, slotB));
+    EXPECT_EQ(slotB, slotA);
+    scheduler.update(250);
+    EXPECT_TRUE(a.phases.empty());
+    EXPECT_TRUE(b.phases.empty());
+}
+
+} // namespace ai_test_section_base
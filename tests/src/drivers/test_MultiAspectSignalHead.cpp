@@ -0,0 +1,219 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: include/railway/drivers/MultiAspectSignalHead.h
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <array>
+#include <memory>
+#include <vector>
+#include "railway/drivers/FlashScheduler.h"
+#include "railway/drivers/MultiAspectSignalHead.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_base {
+
+/* test_MultiAspectSignalHead.cpp – four-aspect lamp patterns and shared flashing */
+
+using namespace railway::drivers;
+using namespace railway::hal;
+using Head = BasicMultiAspectSignalHead<MockGpio>;
+
+constexpr Pin kRed = 1;
+constexpr Pin kYellow = 2;
+constexpr Pin kGreen = 3;
+constexpr Pin kYellow2 = 4;
+
+class MultiAspectSignalHeadTest : public ::testing::Test {
+protected:
+    std::unique_ptr<MockGpio> gpio_ = std::make_unique<MockGpio>();
+
+    // Lit lamps in red, yellow, green, second-yellow order.
+    std::array<bool, 4> lamps(bool activeHigh = true) const {
+        const PinLevel on = activeHigh ? PinLevel::High : PinLevel::Low;
+        return {gpio_->read(kRed) == on, gpio_->read(kYellow) == on, gpio_->read(kGreen) == on,
+                gpio_->read(kYellow2) == on};
+    }
+};
+
+using Lamps = std::array<bool, 4>;
+
+TEST_F(MultiAspectSignalHeadTest, ShowsEveryFourAspectPattern) {
+    Head head(fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2), *gpio_);
+    head.init();
+    EXPECT_EQ(lamps(), (Lamps{true, false, false, false}));
+
+    head.setAspect(Aspect::Caution);
+    EXPECT_EQ(lamps(), (Lamps{false, true, false, false}));
+    head.setAspect(Aspect::DoubleCaution);
+    EXPECT_EQ(lamps(), (Lamps{false, true, false, true}));
+    head.setAspect(Aspect::Clear);
+    EXPECT_EQ(lamps(), (Lamps{false, false, true, false}));
+    head.setAspect(Aspect::Stop);
+    EXPECT_EQ(lamps(), (Lamps{true, false, false, false}));
+}
+
+TEST_F(MultiAspectSignalHeadTest, ActiveLowLampsAcrossPorts) {
+    constexpr Pin kFarYellow2 = 70;
+    Head head(fourAspectHeadConfig(kRed, 40, kGreen, kFarYellow2, false), *gpio_);
+    head.init();
+
+    head.setAspect(Aspect::DoubleCaution);
+    EXPECT_EQ(gpio_->read(kRed), PinLevel::High);
+    EXPECT_EQ(gpio_->read(40), PinLevel::Low);
+    EXPECT_EQ(gpio_->read(kGreen), PinLevel::High);
+    EXPECT_EQ(gpio_->read(kFarYellow2), PinLevel::Low);
+}
+
+TEST_F(MultiAspectSignalHeadTest, UnsupportedAspectFallsBackToStop) {
+    MultiAspectSignalHeadConfig cfg = fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2);
+    cfg.patterns[static_cast<std::size_t>(Aspect::FlashingDoubleCaution)] = LampPattern{};
+    Head head(cfg, *gpio_);
+    head.init();
+
+    EXPECT_FALSE(head.supports(Aspect::FlashingDoubleCaution));
+    head.setAspect(Aspect::FlashingDoubleCaution);
+    EXPECT_EQ(head.currentAspect(), Aspect::Stop);
+    head.setAspect(static_cast<Aspect>(42));
+    EXPECT_EQ(head.currentAspect(), Aspect::Stop);
+    EXPECT_EQ(lamps(), (Lamps{true, false, false, false}));
+}
+
+TEST_F(MultiAspectSignalHeadTest, ConflictingPatternLeavesOnlyStop) {
+    MultiAspectSignalHeadConfig cfg = fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2);
+    // Red and green together.
+    cfg.patterns[static_cast<std::size_t>(Aspect::Clear)].steady |= 1U << 0;
+    Head head(cfg, *gpio_);
+    head.init();
+
+    EXPECT_FALSE(head.configValid());
+    EXPECT_FALSE(head.supports(Aspect::Clear));
+    EXPECT_FALSE(head.supports(Aspect::Caution));
+    head.setAspect(Aspect::Clear);
+    EXPECT_EQ(head.currentAspect(), Aspect::Stop);
+    EXPECT_EQ(lamps(), (Lamps{true, false, false, false}));
+}
+
+TEST_F(MultiAspectSignalHeadTest, UnsafeStopLeavesHeadDark) {
+    MultiAspectSignalHeadConfig cfg = fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2);
+    cfg.patterns[static_cast<std::size_t>(Aspect::Stop)] = LampPattern{0, 1U << 0};
+    Head head(cfg, *gpio_);
+    head.init();
+
+    EXPECT_FALSE(head.configValid());
+    head.setAspect(Aspect::Caution);
+    EXPECT_EQ(head.currentAspect(), Aspect::Stop);
+    EXPECT_EQ(lamps(), (Lamps{false, false, false, false}));
+
+    cfg.patterns[static_cast<std::size_t>(Aspect::Stop)] = LampPattern{};
+    Head empty(cfg, *gpio_);
+    EXPECT_FALSE(empty.configValid());
+    EXPECT_TRUE(Head(fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2), *gpio_).configValid());
+}
+
+TEST_F(MultiAspectSignalHeadTest, FlashingWithoutSchedulerIsSteady) {
+    Head head(fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2), *gpio_);
+    head.init();
+    head.setAspect(Aspect::FlashingDoubleCaution);
+    EXPECT_EQ(lamps(), (Lamps{false, true, false, true}));
+}
+
+TEST_F(MultiAspectSignalHeadTest, HeadsFlashInPhaseFromOneScheduler) {
+    StaticFlashScheduler<8> scheduler(500);
+    Head a(fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2), *gpio_);
+    Head b(fourAspectHeadConfig(11, 12, 13, 14), *gpio_);
+    ASSERT_TRUE(a.attachFlashScheduler(&scheduler));
+    ASSERT_TRUE(b.attachFlashScheduler(&scheduler));
+    a.init();
+    b.init();
+
+    scheduler.update(100);
+    a.setAspect(Aspect::FlashingDoubleCaution);
+    b.setAspect(Aspect::FlashingCaution);
+    EXPECT_EQ(lamps(), (Lamps{false, true, false, true}));
+    EXPECT_EQ(gpio_->read(12), PinLevel::High);
+
+    scheduler.update(500);
+    EXPECT_EQ(lamps(), (Lamps{false, false, false, false}));
+    EXPECT_EQ(gpio_->read(12), PinLevel::Low);
+
+    scheduler.update(1000);
+    EXPECT_EQ(lamps(), (Lamps{false, true, false, true}));
+    EXPECT_EQ(gpio_->read(12), PinLevel::High);
+
+    // A steady aspect stops flashing; the scheduler no longer calls the head.
+    a.setAspect(Aspect::Caution);
+    scheduler.update(1500);
+    EXPECT_EQ(lamps(), (Lamps{false, true, false, false}));
+    EXPECT_EQ(gpio_->read(12), PinLevel::Low);
+}
+
+TEST_F(MultiAspectSignalHeadTest, FlashingAspectSetInDarkPhaseStartsDark) {
+    StaticFlashScheduler<1> scheduler(500);
+    Head head(fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2), *gpio_);
+    ASSERT_TRUE(head.attachFlashScheduler(&scheduler));
+    head.init();
+
+    scheduler.update(600);
+    head.setAspect(Aspect::FlashingCaution);
+    EXPECT_EQ(lamps(), (Lamps{false, false, false, false}));
+    scheduler.update(1000);
+    EXPECT_EQ(lamps(), (Lamps{false, true, false, false}));
+}
+
+TEST_F(MultiAspectSignalHeadTest, DestroyedHeadLeavesScheduler) {
+    StaticFlashScheduler<1> scheduler(500);
+    {
+        Head head(fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2), *gpio_);
+        ASSERT_TRUE(head.attachFlashScheduler(&scheduler));
+        head.init();
+        head.setAspect(Aspect::FlashingCaution);
+    }
+    EXPECT_FALSE(scheduler.isFlashing(0));
+    scheduler.update(500);
+
+    Head other(fourAspectHeadConfig(kRed, kYellow, kGreen, kYellow2), *gpio_);
+    EXPECT_TRUE(other.attachFlashScheduler(&scheduler));
+}
+
+// Lamps spread over three ports: a change must never show the union of old and new patterns.
+TEST_F(MultiAspectSignalHeadTest, MultiPortChangesDarkenBeforeLighting) {
+    class CheckingGpio final : public IGpio {
+    public:
+        std::unique_ptr<MockGpio> pins = std::make_unique<MockGpio>();
+        std::vector<int> litCounts;
+        void configure(Pin pin, PinMode mode) override { pins->configure(pin, mode); }
+        PinLevel read(Pin pin) const override { return pins->read(pin); }
+        void write(Pin pin, PinLevel level) override { pins->write(pin, level); }
+        void writeMasked(Port port, PortMask mask, PortMask value) override {
+            pins->writeMasked(port, mask, value);
+            litCounts.push_back((read(1) == PinLevel::High) + (read(33) == PinLevel::High) +
+                                (read(65) == PinLevel::High) + (read(66) == PinLevel::High));
+        }
+    };
+    CheckingGpio gpio;
+    MultiAspectSignalHead head(fourAspectHeadConfig(1, 33, 65, 66), gpio);
+    head.init();
+
+    const Aspect sequence[] = {Aspect::Clear, Aspect::DoubleCaution, Aspect::Stop, Aspect::DoubleCaution,
+                               Aspect::Caution, Aspect::Clear};
+    for (Aspect aspect : sequence) {
+        gpio.litCounts.clear();
+        head.setAspect(aspect);
+        for (int lit : gpio.litCounts) {
+            // DoubleCaution lights two lamps; nothing ever shows more than the larger pattern.
+            EXPECT_LE(lit, 2);
+        }
+    }
+    // Stop -> DoubleCaution: red goes dark before the yellows light.
+    head.setAspect(Aspect::Stop);
+    gpio.litCounts.clear();
+    head.setAspect(Aspect::DoubleCaution);
+    ASSERT_FALSE(gpio.litCounts.empty());
+    EXPECT_EQ(gpio.litCounts.front(), 0);
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,345 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/SignalBank.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "railway/drivers/SignalBank.h"
+#include "railway/drivers/SignalHead.h"
+#include "railway/hal/MockGpio.h"
+#include "Lcg.h"
+
+namespace ai_test_section_base {
+
+/* test_SignalBank.cpp – batched output stage vs SignalHead */
+
+using railway::drivers::Aspect;
+using railway::drivers::SignalBank;
+using railway::drivers::SignalHead;
+using railway::drivers::SignalHeadConfig;
+using railway::drivers::StaticSignalBank;
+using railway::hal::MockGpio;
+using railway::hal::Pin;
+using railway::hal::PinLevel;
+using railway::hal::Port;
+using railway::hal::PortMask;
+using railway::test::Lcg;
+
+// Counts masked writes and, after each one, checks that no registered head has two lamps lit.
+class CheckingGpio final : public railway::hal::IGpio {
+public:
+    std::unique_ptr<MockGpio> pins = std::make_unique<MockGpio>();
+    std::vector<SignalHeadConfig> heads;
+    std::size_t maskedWrites{0};
+    std::size_t violations{0};
+
+    void configure(Pin pin, railway::hal::PinMode mode) override {
+        pins->configure(pin, mode);
+    }
+    PinLevel read(Pin pin) const override {
+        return pins->read(pin);
+    }
+    void write(Pin pin, PinLevel level) override {
+        pins->write(pin, level);
+        check();
+    }
+    void writeMasked(Port port, PortMask mask, PortMask value) override {
+        pins->writeMasked(port, mask, value);
+        ++maskedWrites;
+        check();
+    }
+    PortMask readPort(Port port, PortMask mask) const override {
+        ++portReads;
+        return pins->readPort(port, mask);
+    }
+
+    mutable std::size_t portReads{0};
+
+    int litLamps(const SignalHeadConfig& cfg) const {
+        const PinLevel on = cfg.activeHigh ? PinLevel::High : PinLevel::Low;
+        return (read(cfg.redPin) == on) + (read(cfg.yellowPin) == on) + (read(cfg.greenPin) == on);
+    }
+
+private:
+    void check() {
+        for (const auto& cfg : heads) {
+            if (litLamps(cfg) > 1) {
+                ++violations;
+            }
+        }
+    }
+};
+
+SignalHeadConfig head(Pin red, Pin yellow, Pin green, bool activeHigh = true) {
+    SignalHeadConfig cfg;
+    cfg.redPin = red;
+    cfg.yellowPin = yellow;
+    cfg.greenPin = green;
+    cfg.activeHigh = activeHigh;
+    return cfg;
+}
+
+// 120 heads over pins 0..359 in shuffled order, so most heads span two or three ports, with
+// mixed polarity. Returns the configs.
+std::vector<SignalHeadConfig> scatteredHeads(std::uint32_t seed) {
+    std::vector<Pin> pins(360);
+    for (std::size_t i = 0; i < pins.size(); ++i) {
+        pins[i] = static_cast<Pin>(i);
+    }
+    Lcg rng{seed};
+    for (std::size_t i = pins.size() - 1; i > 0; --i) {
+        std::swap(pins[i], pins[rng.next(static_cast<std::uint32_t>(i + 1))]);
+    }
+    std::vector<SignalHeadConfig> configs;
+    for (std::size_t h = 0; h < 120; ++h) {
+        configs.push_back(head(pins[3 * h], pins[3 * h + 1], pins[3 * h + 2], (h % 3) != 0));
+    }
+    return configs;
+}
+
+TEST(SignalBankTest, MatchesSignalHeadsAndNeverLightsTwoLamps) {
+    const auto configs = scatteredHeads(7);
+    auto bank = std::make_unique<StaticSignalBank<120, 16>>();
+    CheckingGpio gpio;
+    auto reference = std::make_unique<MockGpio>();
+    std::vector<std::unique_ptr<SignalHead>> heads;
+    for (std::size_t h = 0; h < configs.size(); ++h) {
+        ASSERT_TRUE(bank->configure(h, configs[h])) << h;
+        heads.push_back(std::make_unique<SignalHead>(configs[h], *reference));
+        heads.back()->init();
+    }
+    bank->init(gpio);
+    // Checked from here: before init() the pins hold whatever the backend started with.
+    gpio.heads = configs;
+    for (const auto& cfg : configs) {
+        ASSERT_EQ(gpio.litLamps(cfg), 1);
+    }
+
+    Lcg rng{99};
+    for (int tick = 0; tick < 200; ++tick) {
+        for (int n = 0; n < 15; ++n) {
+            const std::size_t h = rng.next(120);
+            const auto aspect = static_cast<Aspect>(rng.next(3));
+            bank->setAspect(h, aspect);
+            heads[h]->setAspect(aspect);
+        }
+        bank->flush(gpio);
+        for (Pin pin = 0; pin < 360; ++pin) {
+            ASSERT_EQ(gpio.read(pin), reference->read(pin)) << "tick " << tick << " pin " << pin;
+        }
+    }
+    EXPECT_EQ(gpio.violations, 0u);
+}
+
+TEST(SignalBankTest, HeadsOnSharedPortsNeedOneWritePerPort) {
+    auto bank = std::make_unique<StaticSignalBank<20, 4>>();
+    CheckingGpio gpio;
+    // 10 heads per port on ports 0 and 1, lamps packed 3 per head.
+    for (std::size_t h = 0; h < 20; ++h) {
+        const auto base = static_cast<Pin>((h / 10) * 32 + (h % 10) * 3);
+        ASSERT_TRUE(bank->configure(h, head(base, base + 1, base + 2)));
+    }
+    bank->init(gpio);
+    EXPECT_EQ(bank->portCount(), 2u);
+
+    gpio.maskedWrites = 0;
+    for (std::size_t h = 0; h < 20; ++h) {
+        bank->setAspect(h, Aspect::Clear);
+    }
+    EXPECT_EQ(bank->flush(gpio), 2u);
+    EXPECT_EQ(gpio.maskedWrites, 2u);
+
+    bank->setAspect(3, Aspect::Caution);
+    EXPECT_EQ(bank->flush(gpio), 1u);
+}
+
+TEST(SignalBankTest, UnchangedAspectsWriteNothing) {
+    auto bank = std::make_unique<StaticSignalBank<4, 2>>();
+    CheckingGpio gpio;
+    ASSERT_TRUE(bank->configure(0, head(0, 1, 2)));
+    ASSERT_TRUE(bank->configure(1, head(3, 40, 5)));
+    bank->init(gpio);
+
+    EXPECT_EQ(bank->flush(gpio), 0u);
+    bank->setAspect(0, Aspect::Stop);
+    EXPECT_EQ(bank->flush(gpio), 0u);
+
+    // Changed and changed back before the flush.
+    bank->setAspect(1, Aspect::Clear);
+    bank->setAspect(1, Aspect::Stop);
+    EXPECT_EQ(bank->flush(gpio), 0u);
+}
+
+TEST(SignalBankTest, MultiPortHeadGoesDarkBeforeLighting) {
+    auto bank = std::make_unique<StaticSignalBank<1, 3>>();
+    CheckingGpio gpio;
+    const SignalHeadConfig cfg = head(1, 33, 65, false);
+    ASSERT_TRUE(bank->configure(0, cfg));
+    bank->init(gpio);
+    gpio.heads.push_back(cfg);
+    EXPECT_EQ(gpio.read(1), PinLevel::Low);
+
+    const Aspect sequence[] = {Aspect::Clear, Aspect::Stop, Aspect::Caution, Aspect::Clear, Aspect::Stop};
+    for (Aspect aspect : sequence) {
+        bank->setAspect(0, aspect);
+        EXPECT_EQ(bank->flush(gpio), 2u);
+        EXPECT_EQ(gpio.litLamps(cfg), 1);
+    }
+    EXPECT_EQ(gpio.violations, 0u);
+}
+
+TEST(SignalBankTest, UnknownAspectFailsSafeToStop) {
+    auto bank = std::make_unique<StaticSignalBank<1, 1>>();
+    CheckingGpio gpio;
+    ASSERT_TRUE(bank->configure(0, head(0, 1, 2)));
+    bank->init(gpio);
+    bank->setAspect(0, Aspect::Clear);
+    bank->flush(gpio);
+
+    bank->setAspect(0, static_cast<Aspect>(7));
+    bank->flush(gpio);
+    EXPECT_EQ(bank->aspect(0), Aspect::Stop);
+    EXPECT_EQ(gpio.read(0), PinLevel::High);
+    EXPECT_EQ(gpio.read(2), PinLevel::Low);
+}
+
+TEST(SignalBankTest, ConfigureRejectsConflictsWithoutSideEffects) {
+    auto bank = std::make_unique<StaticSignalBank<4, 2>>();
+    EXPECT_FALSE(bank->configure(4, head(0, 1, 2)));
+    EXPECT_FALSE(bank->configure(0, head(0, 0, 2)));
+    ASSERT_TRUE(bank->configure(0, head(0, 1, 2)));
+    EXPECT_FALSE(bank->configure(0, head(3, 4, 5)));
+    EXPECT_FALSE(bank->configure(1, head(2, 3, 4)));
+    // Needs ports 1 and 2 but only one slot is left.
+    EXPECT_FALSE(bank->configure(1, head(32, 64, 65)));
+    EXPECT_EQ(bank->portCount(), 1u);
+    EXPECT_TRUE(bank->configure(1, head(32, 33, 34)));
+    EXPECT_EQ(bank->portCount(), 2u);
+}
+
+// Head with proving inputs 64 pins above its lamps, i.e. on ports 2 and 3 for lamps on 0 and 1.
+SignalHeadConfig provingHead(Pin red, Pin yellow, Pin green) {
+    SignalHeadConfig cfg = head(red, yellow, green);
+    cfg.proving = true;
+    cfg.redProvePin = static_cast<Pin>(red + 64);
+    cfg.yellowProvePin = static_cast<Pin>(yellow + 64);
+    cfg.greenProvePin = static_cast<Pin>(green + 64);
+    return cfg;
+}
+
+// Copies every lamp output onto its proving input.
+void followLamps(CheckingGpio& gpio, const std::vector<SignalHeadConfig>& configs) {
+    for (const auto& cfg : configs) {
+        gpio.pins->setInputLevel(cfg.redProvePin, gpio.read(cfg.redPin));
+        gpio.pins->setInputLevel(cfg.yellowProvePin, gpio.read(cfg.yellowPin));
+        gpio.pins->setInputLevel(cfg.greenProvePin, gpio.read(cfg.greenPin));
+    }
+}
+
+TEST(SignalBankTest, VerifyReadsEachProvingPortOnce) {
+    auto bank = std::make_unique<StaticSignalBank<20, 4>>();
+    CheckingGpio gpio;
+    std::vector<SignalHeadConfig> configs;
+    for (std::size_t h = 0; h < 20; ++h) {
+        const auto base = static_cast<Pin>((h / 10) * 32 + (h % 10) * 3);
+        configs.push_back(provingHead(base, base + 1, base + 2));
+        ASSERT_TRUE(bank->configure(h, configs.back()));
+    }
+    bank->init(gpio);
+    EXPECT_EQ(bank->portCount(), 4u);
+
+    for (std::size_t h = 0; h < 20; h += 3) {
+        bank->setAspect(h, Aspect::Clear);
+    }
+    bank->flush(gpio);
+    followLamps(gpio, configs);
+
+    gpio.portReads = 0;
+    EXPECT_TRUE(bank->verify(gpio));
+    EXPECT_EQ(gpio.portReads, 2u);
+    EXPECT_EQ(bank->lampFaultCount(), 0u);
+}
+
+TEST(SignalBankTest, FailedLampFaultsOnlyItsHead) {
+    auto bank = std::make_unique<StaticSignalBank<2, 4>>();
+    CheckingGpio gpio;
+    const std::vector<SignalHeadConfig> configs{provingHead(0, 1, 2), provingHead(3, 4, 5)};
+    ASSERT_TRUE(bank->configure(0, configs[0]));
+    ASSERT_TRUE(bank->configure(1, configs[1]));
+    bank->init(gpio);
+    bank->setAspect(0, Aspect::Caution);
+    bank->setAspect(1, Aspect::Caution);
+    bank->flush(gpio);
+    followLamps(gpio, configs);
+    // Head 1's yellow lamp is dark.
+    gpio.pins->setInputLevel(configs[1].yellowProvePin, PinLevel::Low);
+
+    EXPECT_TRUE(bank->verify(gpio));
+    EXPECT_FALSE(bank->verify(gpio));
+    EXPECT_TRUE(bank->lampsProven(0));
+    EXPECT_FALSE(bank->lampsProven(1));
+    EXPECT_EQ(bank->lampFaultCount(), 1u);
+
+    // Changed but not yet flushed: not checked against the new aspect.
+    bank->setAspect(0, Aspect::Clear);
+    EXPECT_FALSE(bank->verify(gpio));
+    EXPECT_TRUE(bank->lampsProven(0));
+
+    bank->clearLampFault(1);
+    EXPECT_TRUE(bank->lampsProven(1));
+}
+
+TEST(SignalBankTest, FaultedHeadIsForcedToStop) {
+    auto bank = std::make_unique<StaticSignalBank<2, 4>>();
+    CheckingGpio gpio;
+    const std::vector<SignalHeadConfig> configs{provingHead(0, 1, 2), provingHead(3, 4, 5)};
+    ASSERT_TRUE(bank->configure(0, configs[0]));
+    ASSERT_TRUE(bank->configure(1, configs[1]));
+    bank->init(gpio);
+    bank->setAspect(0, Aspect::Clear);
+    bank->setAspect(1, Aspect::Clear);
+    bank->flush(gpio);
+    followLamps(gpio, configs);
+    // Head 0's green lamp is dark.
+    gpio.pins->setInputLevel(configs[0].greenProvePin, PinLevel::Low);
+    bank->verify(gpio);
+    ASSERT_FALSE(bank->verify(gpio));
+
+    // The fault alone is enough: the next flush shows Stop.
+    bank->flush(gpio);
+    EXPECT_EQ(bank->aspect(0), Aspect::Stop);
+    EXPECT_EQ(gpio.read(0), PinLevel::High);
+    EXPECT_EQ(gpio.read(2), PinLevel::Low);
+
+    // Further aspects are refused until the fault is cleared.
+    bank->setAspect(0, Aspect::Clear);
+    bank->flush(gpio);
+    EXPECT_EQ(bank->aspect(0), Aspect::Stop);
+    EXPECT_EQ(gpio.read(0), PinLevel::High);
+    EXPECT_EQ(gpio.read(2), PinLevel::Low);
+    EXPECT_EQ(gpio.read(5), PinLevel::High);
+
+    bank->clearLampFault(0);
+    bank->setAspect(0, Aspect::Clear);
+    bank->flush(gpio);
+    EXPECT_EQ(gpio.read(2), PinLevel::High);
+}
+
+TEST(SignalBankTest, ProvingPinsMayNotOverlapLamps) {
+    auto bank = std::make_unique<StaticSignalBank<2, 4>>();
+    ASSERT_TRUE(bank->configure(0, provingHead(0, 1, 2)));
+    SignalHeadConfig cfg = head(64, 5, 6);
+    EXPECT_FALSE(bank->configure(1, cfg));
+    cfg = provingHead(3, 4, 5);
+    cfg.greenProvePin = 4;
+    EXPECT_FALSE(bank->configure(1, cfg));
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,94 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: include/railway/drivers/SignalHeadType.h
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include "railway/drivers/MultiAspectSignalHead.h"
+#include "railway/drivers/SignalHeadType.h"
+
+namespace ai_test_section_base {
+
+/* test_SignalHeadType.cpp – compile-time head descriptions and their lookup tables */
+
+using railway::drivers::Aspect;
+using railway::drivers::FourAspectHead;
+using railway::drivers::HeadTypeTables;
+using railway::drivers::LampPattern;
+using railway::drivers::ThreeAspectHead;
+using railway::drivers::headTypeIsSafe;
+using railway::drivers::kAspectCount;
+
+// Lights red and green together for Clear.
+struct ConflictingHead {
+    static constexpr std::size_t kLampCount = 3;
+    static constexpr std::array<LampPattern, kAspectCount> kPatterns{{{1, 0}, {2, 0}, {5, 0}, {}, {}, {}}};
+    static constexpr std::array<std::uint8_t, 1> kConflicts{1 | 4};
+};
+
+// Flashing red for Stop.
+struct FlashingStopHead {
+    static constexpr std::size_t kLampCount = 1;
+    static constexpr std::array<LampPattern, kAspectCount> kPatterns{{{0, 1}, {}, {}, {}, {}, {}}};
+    static constexpr std::array<std::uint8_t, 0> kConflicts{};
+};
+
+// Pattern uses a lamp the head does not have.
+struct MissingLampHead {
+    static constexpr std::size_t kLampCount = 2;
+    static constexpr std::array<LampPattern, kAspectCount> kPatterns{{{1, 0}, {4, 0}, {}, {}, {}, {}}};
+    static constexpr std::array<std::uint8_t, 0> kConflicts{};
+};
+
+static_assert(headTypeIsSafe<ThreeAspectHead>());
+static_assert(headTypeIsSafe<FourAspectHead>());
+static_assert(!headTypeIsSafe<ConflictingHead>());
+static_assert(!headTypeIsSafe<FlashingStopHead>());
+static_assert(!headTypeIsSafe<MissingLampHead>());
+
+using Three = HeadTypeTables<ThreeAspectHead>;
+using Four = HeadTypeTables<FourAspectHead>;
+
+static_assert(Three::shown(Aspect::Clear) == 2);
+static_assert(Three::shown(Aspect::DoubleCaution) == 0);
+static_assert(Four::shown(Aspect::FlashingDoubleCaution) == 5);
+
+TEST(SignalHeadTypeTest, EveryRawAspectResolvesToAShownAspect) {
+    for (std::size_t raw = 0; raw < 256; ++raw) {
+        const auto aspect = static_cast<Aspect>(raw);
+        const std::size_t expectThree = (raw < 3) ? raw : 0;
+        const std::size_t expectFour = (raw < kAspectCount) ? raw : 0;
+        EXPECT_EQ(Three::shown(aspect), expectThree) << raw;
+        EXPECT_EQ(Four::shown(aspect), expectFour) << raw;
+    }
+}
+
+TEST(SignalHeadTypeTest, LevelTablesApplyPolarity) {
+    const std::array<std::uint8_t, kAspectCount> high{0b001, 0b010, 0b100, 0b001, 0b001, 0b001};
+    const std::array<std::uint8_t, kAspectCount> low{0b110, 0b101, 0b011, 0b110, 0b110, 0b110};
+    EXPECT_EQ(Three::levels(true), high);
+    EXPECT_EQ(Three::levels(false), low);
+
+    // Flashing lamps count as lit.
+    EXPECT_EQ(Four::kActiveHighLevels[static_cast<std::size_t>(Aspect::FlashingDoubleCaution)], 0b1010);
+    EXPECT_EQ(Four::kActiveLowLevels[static_cast<std::size_t>(Aspect::FlashingCaution)], 0b1101);
+}
+
+TEST(SignalHeadTypeTest, FourAspectConfigUsesHeadTypePatterns) {
+    const auto cfg = railway::drivers::fourAspectHeadConfig(1, 2, 3, 4);
+    EXPECT_EQ(cfg.lampCount, FourAspectHead::kLampCount);
+    for (std::size_t a = 0; a < kAspectCount; ++a) {
+        EXPECT_EQ(cfg.patterns[a].steady, FourAspectHead::kPatterns[a].steady) << a;
+        EXPECT_EQ(cfg.patterns[a].flashing, FourAspectHead::kPatterns[a].flashing) << a;
+    }
+    for (std::size_t c = 0; c < FourAspectHead::kConflicts.size(); ++c) {
+        EXPECT_EQ(cfg.conflicts[c], FourAspectHead::kConflicts[c]) << c;
+    }
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,135 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/TrackCircuitBank.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "railway/drivers/TrackCircuitBank.h"
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+#include "Lcg.h"
+
+namespace ai_test_section_base {
+
+/* test_TrackCircuitBank.cpp – bit-parallel debounce vs TrackCircuitInput */
+
+using railway::drivers::StaticTrackCircuitBank;
+using railway::drivers::TrackCircuitBank;
+using railway::drivers::TrackCircuitConfig;
+using railway::drivers::TrackCircuitInput;
+using railway::hal::MockGpio;
+using railway::hal::Pin;
+using railway::hal::PinLevel;
+using railway::test::Lcg;
+
+constexpr std::size_t kCircuits = 200;
+
+// Drives kCircuits TrackCircuitInputs and one bank from the same MockGpio (circuit i on pin i,
+// so MockGpio's level words are exactly the bank's input bitmap) and compares every tick.
+void runDifferential(std::uint32_t seed, railway::Millis startMs, bool withUnconfiguredCircuits) {
+    auto gpio = std::make_unique<MockGpio>();
+    auto bank = std::make_unique<StaticTrackCircuitBank<kCircuits>>();
+    std::vector<std::unique_ptr<TrackCircuitInput>> reference(kCircuits);
+    Lcg rng{seed};
+
+    for (std::size_t i = 0; i < kCircuits; ++i) {
+        gpio->setInputLevel(static_cast<Pin>(i), rng.next(2) != 0 ? PinLevel::High : PinLevel::Low);
+        if (withUnconfiguredCircuits && i % 7 == 3) {
+            continue;
+        }
+        TrackCircuitConfig cfg;
+        cfg.pin = static_cast<Pin>(i);
+        cfg.activeLow = rng.next(4) != 0;
+        cfg.debounceMs = rng.next(60);
+        cfg.stuckLowFaultMs = rng.next(400);
+        reference[i] = std::make_unique<TrackCircuitInput>(cfg, *gpio);
+        reference[i]->init();
+        ASSERT_TRUE(bank->configure(i, cfg));
+    }
+
+    std::uint64_t levels[TrackCircuitBank::wordsFor(kCircuits)];
+    auto capture = [&] {
+        for (std::size_t w = 0; w < TrackCircuitBank::wordsFor(kCircuits); ++w) {
+            levels[w] = gpio->levelWord(w);
+        }
+    };
+    capture();
+    bank->init(levels);
+
+    railway::Millis now = startMs;
+    for (int tick = 0; tick < 5000; ++tick) {
+        for (int flips = static_cast<int>(rng.next(6)); flips > 0; --flips) {
+            const auto pin = static_cast<Pin>(rng.next(kCircuits));
+            gpio->setInputLevel(pin, gpio->read(pin) == PinLevel::High ? PinLevel::Low : PinLevel::High);
+        }
+        capture();
+        bank->update(now, levels);
+
+        for (std::size_t i = 0; i < kCircuits; ++i) {
+            if (reference[i] == nullptr) {
+                ASSERT_FALSE(bank->isOccupied(i));
+                ASSERT_FALSE(bank->isHealthy(i));
+                continue;
+            }
+            reference[i]->update(now);
+            ASSERT_EQ(bank->isOccupied(i), reference[i]->isOccupied()) << "circuit " << i << " tick " << tick;
+            ASSERT_EQ(bank->isHealthy(i), reference[i]->isHealthy()) << "circuit " << i << " tick " << tick;
+        }
+        // Mostly short steps, with the occasional repeat of the same timestamp.
+        now += rng.next(30);
+    }
+}
+
+TEST(TrackCircuitBankTest, MatchesTrackCircuitInputFromTimeZero) {
+    runDifferential(1, 0, false);
+}
+
+TEST(TrackCircuitBankTest, MatchesTrackCircuitInputAcrossMillisWrap) {
+    runDifferential(2, 0xFFFFF000u, false);
+}
+
+TEST(TrackCircuitBankTest, UnconfiguredCircuitsStayZeroInOutputs) {
+    runDifferential(3, 100, true);
+}
+
+TEST(TrackCircuitBankTest, PackedOutputsMatchPerCircuitQueries) {
+    StaticTrackCircuitBank<130> bank;
+    TrackCircuitConfig cfg;
+    cfg.debounceMs = 10;
+    cfg.stuckLowFaultMs = 100;
+    for (std::size_t i = 0; i < 130; ++i) {
+        ASSERT_TRUE(bank.configure(i, cfg));
+    }
+    EXPECT_FALSE(bank.configure(130, cfg));
+    EXPECT_EQ(bank.wordCount(), 3u);
+
+    std::uint64_t levels[3] = {~std::uint64_t{0}, ~std::uint64_t{0}, 0x3};
+    bank.init(levels);
+    levels[1] &= ~(std::uint64_t{1} << 5); // circuit 69 de-energized
+    bank.update(1, levels);
+    EXPECT_EQ(bank.occupiedWord(1), 0u);
+    bank.update(11, levels);
+    EXPECT_EQ(bank.occupiedWord(1), std::uint64_t{1} << 5);
+    EXPECT_TRUE(bank.isOccupied(69));
+    bank.update(111, levels);
+
+    std::uint64_t occupied[3] = {};
+    std::uint64_t healthy[3] = {};
+    bank.copyOccupied(occupied);
+    bank.copyHealthy(healthy);
+    EXPECT_EQ(occupied[0], 0u);
+    EXPECT_EQ(occupied[1], std::uint64_t{1} << 5);
+    EXPECT_EQ(occupied[2], 0u);
+    EXPECT_EQ(healthy[1], ~(std::uint64_t{1} << 5));
+    EXPECT_EQ(healthy[2], 0x3u);
+    EXPECT_FALSE(bank.isHealthy(69));
+    EXPECT_FALSE(bank.isHealthy(500));
+}
+
+} // namespace ai_test_section_base
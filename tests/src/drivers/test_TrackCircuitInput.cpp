@@ -643,3 +643,585 @@ Stubbed/External:
 // Not directly included (needs stubs/external/too deep): configure, readRawClear
 
 }  // namespace
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/TrackCircuitInput.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_events {
+
+/* TrackCircuitInput event-driven mode */
+
+using ::railway::drivers::TrackCircuitInput;
+using namespace ::railway::hal;
+
+// Forwards to MockGpio (which supports edge subscriptions) and counts pin reads.
+class CountingGpio final : public IGpio {
+public:
+    MockGpio backing;
+    mutable int reads{0};
+    bool edgesSupported{true};
+
+    void configure(Pin pin, PinMode mode) override { backing.configure(pin, mode); }
+    PinLevel read(Pin pin) const override {
+        ++reads;
+        return backing.read(pin);
+    }
+    void write(Pin pin, PinLevel level) override { backing.write(pin, level); }
+    bool subscribeEdges(Pin pin, Edge edges, IEdgeListener& listener) override {
+        return edgesSupported && backing.subscribeEdges(pin, edges, listener);
+    }
+    void unsubscribeEdges(Pin pin) override { backing.unsubscribeEdges(pin); }
+};
+
+class TrackCircuitEventTest : public ::testing::Test {
+protected:
+    std::unique_ptr<CountingGpio> gpio_ = std::make_unique<CountingGpio>();
+    TrackCircuitInput::Config cfg_{};
+
+    void SetUp() override {
+        cfg_.pin = 7;
+        cfg_.debounceMs = 100;
+        cfg_.stuckLowFaultMs = 500;
+        cfg_.eventDriven = true;
+        gpio_->backing.setInputLevel(7, PinLevel::High);
+    }
+};
+
+TEST_F(TrackCircuitEventTest, IdleTicksDoNotReadThePin) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    ASSERT_TRUE(circuit.isEventDriven());
+
+    gpio_->reads = 0;
+    for (::railway::Millis t = 10; t < 10000; t += 10) {
+        circuit.update(t);
+    }
+
+    EXPECT_EQ(gpio_->reads, 0);
+    EXPECT_FALSE(circuit.isOccupied());
+}
+
+TEST_F(TrackCircuitEventTest, MatchesPollingModeAcrossDebounceAndFault) {
+    auto pollCfg = cfg_;
+    pollCfg.eventDriven = false;
+    pollCfg.pin = 8;
+    gpio_->backing.setInputLevel(8, PinLevel::High);
+
+    TrackCircuitInput evented(cfg_, *gpio_);
+    TrackCircuitInput polled(pollCfg, *gpio_);
+    evented.init();
+    polled.init();
+
+    for (::railway::Millis t = 10; t <= 2000; t += 10) {
+        if (t == 100 || t == 130 || t == 150) {
+            // Bounce, then settle occupied; long enough to trip the stuck-low fault.
+            const PinLevel level = (t == 130) ? PinLevel::High : PinLevel::Low;
+            gpio_->backing.setInputLevel(7, level);
+            gpio_->backing.setInputLevel(8, level);
+        }
+        if (t == 1500) {
+            gpio_->backing.setInputLevel(7, PinLevel::High);
+            gpio_->backing.setInputLevel(8, PinLevel::High);
+        }
+        evented.update(t);
+        polled.update(t);
+        ASSERT_EQ(evented.isOccupied(), polled.isOccupied()) << "t=" << t;
+        ASSERT_EQ(evented.isHealthy(), polled.isHealthy()) << "t=" << t;
+    }
+    EXPECT_FALSE(evented.isOccupied());
+    EXPECT_TRUE(evented.isHealthy());
+}
+
+TEST_F(TrackCircuitEventTest, FallsBackToPollingWithoutEdgeSupport) {
+    gpio_->edgesSupported = false;
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+
+    EXPECT_FALSE(circuit.isEventDriven());
+    gpio_->reads = 0;
+    circuit.update(10);
+    EXPECT_EQ(gpio_->reads, 1);
+}
+
+}  // namespace ai_test_section_events
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/TrackCircuitInput.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_integrating {
+
+/* TrackCircuitInput integrating (counter) debounce mode */
+
+using ::railway::drivers::DebounceMode;
+using ::railway::drivers::TrackCircuitInput;
+using namespace ::railway::hal;
+
+class TrackCircuitIntegratingTest : public ::testing::Test {
+protected:
+    std::unique_ptr<MockGpio> gpio_ = std::make_unique<MockGpio>();
+    TrackCircuitInput::Config cfg_{};
+
+    void SetUp() override {
+        cfg_.pin = 4;
+        cfg_.debounceMode = DebounceMode::Integrating;
+        cfg_.integrateSamples = 4;
+        cfg_.stuckLowFaultMs = 1000;
+        gpio_->setInputLevel(4, PinLevel::High);
+    }
+};
+
+TEST_F(TrackCircuitIntegratingTest, CleanChangeIsAcceptedAfterConfiguredSamples) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    gpio_->setInputLevel(4, PinLevel::Low);
+
+    for (int i = 1; i < 4; ++i) {
+        circuit.update(static_cast<::railway::Millis>(i));
+        EXPECT_FALSE(circuit.isOccupied()) << "sample " << i;
+    }
+    circuit.update(4);
+    EXPECT_TRUE(circuit.isOccupied());
+
+    gpio_->setInputLevel(4, PinLevel::High);
+    for (int i = 5; i < 8; ++i) {
+        circuit.update(static_cast<::railway::Millis>(i));
+        EXPECT_TRUE(circuit.isOccupied()) << "sample " << i;
+    }
+    circuit.update(8);
+    EXPECT_FALSE(circuit.isOccupied());
+}
+
+TEST_F(TrackCircuitIntegratingTest, GlitchCostsOneSampleInsteadOfRestartingWindow) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+
+    // Low, Low, glitch High, Low, Low: counter 4->3->2->3->2->1, then 0 on the next Low.
+    const PinLevel samples[] = {PinLevel::Low, PinLevel::Low, PinLevel::High, PinLevel::Low, PinLevel::Low};
+    ::railway::Millis t = 0;
+    for (const PinLevel level : samples) {
+        gpio_->setInputLevel(4, level);
+        circuit.update(++t);
+        EXPECT_FALSE(circuit.isOccupied()) << "t=" << t;
+    }
+    circuit.update(++t);
+    EXPECT_TRUE(circuit.isOccupied());
+}
+
+TEST_F(TrackCircuitIntegratingTest, HysteresisHoldsStateUntilCounterSaturates) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    gpio_->setInputLevel(4, PinLevel::Low);
+    for (::railway::Millis t = 1; t <= 4; ++t) {
+        circuit.update(t);
+    }
+    ASSERT_TRUE(circuit.isOccupied());
+
+    // Alternating samples never reach either end again.
+    for (::railway::Millis t = 5; t < 50; ++t) {
+        gpio_->setInputLevel(4, (t % 2) != 0 ? PinLevel::High : PinLevel::Low);
+        circuit.update(t);
+        EXPECT_TRUE(circuit.isOccupied()) << "t=" << t;
+    }
+}
+
+TEST_F(TrackCircuitIntegratingTest, StuckLowFaultStillUsesMilliseconds) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    gpio_->setInputLevel(4, PinLevel::Low);
+    for (::railway::Millis t = 100; t <= 1200; t += 100) {
+        circuit.update(t);
+    }
+    // Occupied from t=400; fault threshold 1000ms not yet reached at t=1200.
+    EXPECT_TRUE(circuit.isOccupied());
+    EXPECT_TRUE(circuit.isHealthy());
+    circuit.update(1400);
+    EXPECT_FALSE(circuit.isHealthy());
+}
+
+TEST_F(TrackCircuitIntegratingTest, ZeroSamplesBehavesLikeOne) {
+    cfg_.integrateSamples = 0;
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    gpio_->setInputLevel(4, PinLevel::Low);
+    circuit.update(1);
+    EXPECT_TRUE(circuit.isOccupied());
+}
+
+TEST_F(TrackCircuitIntegratingTest, EventDrivenModeMatchesPolling) {
+    auto evCfg = cfg_;
+    evCfg.eventDriven = true;
+    evCfg.pin = 5;
+    gpio_->setInputLevel(5, PinLevel::High);
+    TrackCircuitInput polled(cfg_, *gpio_);
+    TrackCircuitInput evented(evCfg, *gpio_);
+    polled.init();
+    evented.init();
+    ASSERT_TRUE(evented.isEventDriven());
+
+    for (::railway::Millis t = 1; t <= 2000; ++t) {
+        if (t == 100 || t == 102 || t == 103 || t == 1500) {
+            const PinLevel level = (t == 102 || t == 1500) ? PinLevel::High : PinLevel::Low;
+            gpio_->setInputLevel(4, level);
+            gpio_->setInputLevel(5, level);
+        }
+        polled.update(t);
+        evented.update(t);
+        ASSERT_EQ(evented.isOccupied(), polled.isOccupied()) << "t=" << t;
+        ASSERT_EQ(evented.isHealthy(), polled.isHealthy()) << "t=" << t;
+    }
+}
+
+}  // namespace ai_test_section_integrating
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/TrackCircuitInput.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_change_events {
+
+/* TrackCircuitInput occupancy change events */
+
+using ::railway::drivers::StaticTrackEventQueue;
+using ::railway::drivers::TrackCircuitInput;
+using ::railway::drivers::TrackEvent;
+using ::railway::drivers::TrackEventKind;
+using namespace ::railway::hal;
+
+std::vector<TrackEvent> drain(::railway::drivers::TrackEventQueue& queue) {
+    std::vector<TrackEvent> events;
+    TrackEvent e;
+    while (queue.pop(e)) {
+        events.push_back(e);
+    }
+    return events;
+}
+
+class TrackCircuitChangeEventTest : public ::testing::Test {
+protected:
+    std::unique_ptr<MockGpio> gpio_ = std::make_unique<MockGpio>();
+    StaticTrackEventQueue<16> queue_;
+    TrackCircuitInput::Config cfg_{};
+
+    void SetUp() override {
+        cfg_.pin = 9;
+        cfg_.debounceMs = 50;
+        cfg_.stuckLowFaultMs = 300;
+        gpio_->setInputLevel(9, PinLevel::High);
+    }
+};
+
+TEST_F(TrackCircuitChangeEventTest, EmitsOccupiedFaultClearedRecoveredInOrder) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    circuit.attachEvents(&queue_);
+
+    for (::railway::Millis t = 10; t <= 1000; t += 10) {
+        if (t == 100) {
+            gpio_->setInputLevel(9, PinLevel::Low);
+        }
+        if (t == 700) {
+            gpio_->setInputLevel(9, PinLevel::High);
+        }
+        circuit.update(t);
+    }
+
+    const auto events = drain(queue_);
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_EQ(events[0].kind, TrackEventKind::Occupied);
+    EXPECT_EQ(events[0].atMs, 150u);
+    EXPECT_EQ(events[0].sinceMs, 100u);
+    EXPECT_EQ(events[1].kind, TrackEventKind::Fault);
+    EXPECT_EQ(events[1].atMs, 450u);
+    EXPECT_EQ(events[1].sinceMs, 150u);
+    EXPECT_EQ(events[2].kind, TrackEventKind::Cleared);
+    EXPECT_EQ(events[2].atMs, 750u);
+    EXPECT_EQ(events[2].sinceMs, 700u);
+    EXPECT_EQ(events[3].kind, TrackEventKind::Recovered);
+    EXPECT_EQ(events[3].atMs, 750u);
+    for (const auto& e : events) {
+        EXPECT_EQ(e.pin, 9u);
+    }
+}
+
+TEST_F(TrackCircuitChangeEventTest, BounceInsideWindowEmitsNothing) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    circuit.attachEvents(&queue_);
+
+    for (::railway::Millis t = 10; t <= 500; t += 10) {
+        gpio_->setInputLevel(9, (t == 100 || t == 120) ? PinLevel::Low : PinLevel::High);
+        circuit.update(t);
+    }
+    EXPECT_TRUE(drain(queue_).empty());
+}
+
+TEST_F(TrackCircuitChangeEventTest, SharedQueueAndDetach) {
+    auto otherCfg = cfg_;
+    otherCfg.pin = 10;
+    gpio_->setInputLevel(10, PinLevel::High);
+    TrackCircuitInput a(cfg_, *gpio_);
+    TrackCircuitInput b(otherCfg, *gpio_);
+    a.init();
+    b.init();
+    a.attachEvents(&queue_);
+    b.attachEvents(&queue_);
+
+    gpio_->setInputLevel(9, PinLevel::Low);
+    gpio_->setInputLevel(10, PinLevel::Low);
+    a.update(100);
+    b.update(100);
+    b.attachEvents(nullptr);
+    a.update(200);
+    b.update(200);
+
+    const auto events = drain(queue_);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].pin, 9u);
+    EXPECT_TRUE(b.isOccupied());
+}
+
+TEST_F(TrackCircuitChangeEventTest, FullQueueDropsAndCounts) {
+    StaticTrackEventQueue<2> small;
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    circuit.attachEvents(&small);
+
+    for (::railway::Millis t = 100; t <= 1000; t += 100) {
+        gpio_->setInputLevel(9, (t / 100) % 2 == 0 ? PinLevel::Low : PinLevel::High);
+        circuit.update(t);
+        circuit.update(t + 60);
+    }
+    EXPECT_EQ(small.size(), 2u);
+    EXPECT_GT(small.dropped(), 0u);
+}
+
+}  // namespace ai_test_section_change_events
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/TrackCircuitInput.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_deadlines {
+
+/* TrackCircuitInput next-deadline query */
+
+using ::railway::drivers::DebounceMode;
+using ::railway::drivers::TrackCircuitInput;
+using namespace ::railway::hal;
+
+TEST(TrackCircuitDeadlineTest, ReportsDebounceThenStuckLowDeadlines) {
+    auto gpio = std::make_unique<MockGpio>();
+    gpio->setInputLevel(2, PinLevel::High);
+    TrackCircuitInput::Config cfg;
+    cfg.pin = 2;
+    cfg.debounceMs = 50;
+    cfg.stuckLowFaultMs = 1000;
+    TrackCircuitInput circuit(cfg, *gpio);
+    circuit.init();
+
+    ::railway::Millis deadline = 0;
+    circuit.update(10);
+    EXPECT_FALSE(circuit.nextDeadlineMs(deadline));
+
+    gpio->setInputLevel(2, PinLevel::Low);
+    circuit.update(100);
+    ASSERT_TRUE(circuit.nextDeadlineMs(deadline));
+    EXPECT_EQ(deadline, 150u);
+
+    circuit.update(150);
+    ASSERT_TRUE(circuit.isOccupied());
+    ASSERT_TRUE(circuit.nextDeadlineMs(deadline));
+    EXPECT_EQ(deadline, 1150u);
+
+    circuit.update(1150);
+    EXPECT_FALSE(circuit.isHealthy());
+    EXPECT_FALSE(circuit.nextDeadlineMs(deadline));
+}
+
+TEST(TrackCircuitDeadlineTest, UnsettledIntegratorIsDueImmediately) {
+    auto gpio = std::make_unique<MockGpio>();
+    gpio->setInputLevel(2, PinLevel::High);
+    TrackCircuitInput::Config cfg;
+    cfg.pin = 2;
+    cfg.debounceMode = DebounceMode::Integrating;
+    cfg.integrateSamples = 3;
+    TrackCircuitInput circuit(cfg, *gpio);
+    circuit.init();
+
+    gpio->setInputLevel(2, PinLevel::Low);
+    circuit.update(40);
+    ::railway::Millis deadline = 0;
+    ASSERT_TRUE(circuit.nextDeadlineMs(deadline));
+    EXPECT_EQ(deadline, 40u);
+}
+
+TEST(TrackCircuitDeadlineTest, ForwardsEdgesInEventMode) {
+    struct Counter final : IEdgeListener {
+        int edges{0};
+        void onEdge(const EdgeEvent&) override { ++edges; }
+    };
+    auto gpio = std::make_unique<MockGpio>();
+    TrackCircuitInput::Config cfg;
+    cfg.pin = 2;
+    cfg.eventDriven = true;
+    TrackCircuitInput circuit(cfg, *gpio);
+    circuit.init();
+    Counter counter;
+    circuit.forwardEdges(&counter);
+
+    gpio->setInputLevel(2, PinLevel::High);
+    ::railway::Millis deadline = 0;
+    EXPECT_TRUE(circuit.nextDeadlineMs(deadline));
+    circuit.forwardEdges(nullptr);
+    gpio->setInputLevel(2, PinLevel::Low);
+    EXPECT_EQ(counter.edges, 1);
+}
+
+}  // namespace ai_test_section_deadlines
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/drivers/TrackCircuitInput.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_stats {
+
+/* TrackCircuitInput maintenance statistics */
+
+using ::railway::drivers::TrackCircuitInput;
+using ::railway::drivers::TrackCircuitStats;
+using namespace ::railway::hal;
+
+class TrackCircuitStatsTest : public ::testing::Test {
+protected:
+    std::unique_ptr<MockGpio> gpio_ = std::make_unique<MockGpio>();
+    TrackCircuitInput::Config cfg_{};
+
+    void SetUp() override {
+        cfg_.pin = 6;
+        cfg_.debounceMs = 50;
+        cfg_.stuckLowFaultMs = 500;
+        gpio_->setInputLevel(6, PinLevel::High);
+    }
+
+    void run(TrackCircuitInput& circuit, ::railway::Millis from, ::railway::Millis to, PinLevel level) {
+        gpio_->setInputLevel(6, level);
+        for (::railway::Millis t = from; t <= to; t += 10) {
+            circuit.update(t);
+        }
+    }
+};
+
+TEST_F(TrackCircuitStatsTest, CountsTransitionsAndRejectedGlitches) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+
+    run(circuit, 10, 100, PinLevel::High);
+    run(circuit, 110, 120, PinLevel::Low);  // glitch, rejected
+    run(circuit, 130, 200, PinLevel::High);
+    run(circuit, 210, 230, PinLevel::Low);  // glitch, rejected
+    run(circuit, 240, 300, PinLevel::High);
+    run(circuit, 310, 400, PinLevel::Low);  // accepted occupancy
+    run(circuit, 410, 500, PinLevel::High); // accepted clear
+
+    const TrackCircuitStats& s = circuit.stats();
+    EXPECT_EQ(s.rawTransitions, 6u);
+    EXPECT_EQ(s.rejectedGlitches, 2u);
+    EXPECT_FALSE(circuit.isOccupied());
+}
+
+TEST_F(TrackCircuitStatsTest, TracksLongestStuckLowStreakAndTimeInFault) {
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+
+    run(circuit, 10, 400, PinLevel::Low);    // occupied from 60
+    run(circuit, 410, 500, PinLevel::High);  // cleared at 460: streak 400
+    EXPECT_EQ(circuit.stats().longestStuckLowMs, 400u);
+    EXPECT_EQ(circuit.stats().timeInFaultMs, 0u);
+
+    run(circuit, 510, 1200, PinLevel::Low);  // occupied from 560, faulted at 1060
+    run(circuit, 1210, 1300, PinLevel::High); // cleared and recovered at 1260
+    EXPECT_EQ(circuit.stats().longestStuckLowMs, 1260u - 560u);
+    EXPECT_EQ(circuit.stats().timeInFaultMs, 1260u - 1060u);
+    EXPECT_TRUE(circuit.isHealthy());
+
+    circuit.resetStats();
+    EXPECT_EQ(circuit.stats().rawTransitions, 0u);
+    EXPECT_EQ(circuit.stats().longestStuckLowMs, 0u);
+}
+
+TEST_F(TrackCircuitStatsTest, TimeInFaultIncludesSkippedEventDrivenTicks) {
+    cfg_.eventDriven = true;
+    TrackCircuitInput circuit(cfg_, *gpio_);
+    circuit.init();
+    ASSERT_TRUE(circuit.isEventDriven());
+
+    run(circuit, 10, 2000, PinLevel::Low);  // occupied at 60, faulted at 560
+    EXPECT_FALSE(circuit.isHealthy());
+    EXPECT_EQ(circuit.stats().timeInFaultMs, 2000u - 560u);
+}
+
+TEST_F(TrackCircuitStatsTest, SnapshotCopiesAllCircuits) {
+    auto otherCfg = cfg_;
+    otherCfg.pin = 7;
+    TrackCircuitInput a(cfg_, *gpio_);
+    TrackCircuitInput b(otherCfg, *gpio_);
+    a.init();
+    b.init();
+    run(a, 10, 20, PinLevel::Low);
+
+    const TrackCircuitInput* circuits[] = {&a, &b};
+    TrackCircuitStats out[2];
+    ::railway::drivers::snapshotStats(circuits, 2, out);
+    EXPECT_EQ(out[0].rawTransitions, 1u);
+    EXPECT_EQ(out[1].rawTransitions, 0u);
+}
+
+}  // namespace ai_test_section_stats
@@ -0,0 +1,109 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/ConcurrentMockGpio.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/ConcurrentMockGpio.h"
+
+namespace ai_test_section_base {
+
+/* test_ConcurrentMockGpio.cpp – lock-free GPIO model shared between threads */
+
+using namespace railway::hal;
+
+TEST(ConcurrentMockGpioTest, BehavesLikeMockGpioOnOneThread) {
+    auto gpio = std::make_unique<ConcurrentMockGpio>();
+    gpio->configure(7, PinMode::OutputPushPull);
+    EXPECT_EQ(gpio->mode(7), PinMode::OutputPushPull);
+    EXPECT_EQ(gpio->mode(8), PinMode::Input);
+
+    gpio->write(7, PinLevel::High);
+    gpio->setInputLevel(40, PinLevel::High);
+    EXPECT_EQ(gpio->read(7), PinLevel::High);
+    EXPECT_EQ(gpio->levelWord(0), (std::uint64_t{1} << 7) | (std::uint64_t{1} << 40));
+    EXPECT_EQ(gpio->readPort(1, 0xFFFFFFFFu), 1u << 8);
+
+    gpio->writeMasked(0, 0x81u, 0x01u);
+    EXPECT_EQ(gpio->read(0), PinLevel::High);
+    EXPECT_EQ(gpio->read(7), PinLevel::Low);
+
+    gpio->setLevelWord(3, 0xF0u);
+    const Pin pins[] = {196, 195, 7};
+    PinLevel levels[3] = {};
+    gpio->readMany(pins, 3, levels);
+    EXPECT_EQ(levels[0], PinLevel::High);
+    EXPECT_EQ(levels[1], PinLevel::Low);
+    EXPECT_EQ(levels[2], PinLevel::Low);
+
+    EXPECT_EQ(gpio->levelWord(ConcurrentMockGpio::kLevelWords), 0u);
+}
+
+TEST(ConcurrentMockGpioTest, WritersOnDifferentPinsOfOneWordDoNotLoseUpdates) {
+    auto gpio = std::make_unique<ConcurrentMockGpio>();
+    constexpr int kRounds = 20000;
+
+    std::thread plant([&] {
+        for (int i = 0; i < kRounds; ++i) {
+            gpio->setInputLevel(2, (i & 1) != 0 ? PinLevel::High : PinLevel::Low);
+        }
+        gpio->setInputLevel(2, PinLevel::High);
+    });
+    std::thread controller([&] {
+        for (int i = 0; i < kRounds; ++i) {
+            gpio->writeMasked(0, 0x1C00u, (i & 1) != 0 ? 0x0400u : 0x1000u);
+        }
+        gpio->writeMasked(0, 0x1C00u, 0x0800u);
+    });
+    plant.join();
+    controller.join();
+
+    EXPECT_EQ(gpio->levelWord(0), (1u << 2) | 0x0800u);
+}
+
+TEST(ConcurrentMockGpioTest, ReaderThatSeesAFlagAlsoSeesEarlierWrites) {
+    auto gpio = std::make_unique<ConcurrentMockGpio>();
+    constexpr Pin kFlag = 64;
+    std::atomic<bool> mismatch{false};
+
+    std::thread visualiser([&] {
+        while (gpio->read(kFlag) == PinLevel::Low) {
+            std::this_thread::yield();
+        }
+        if (gpio->levelWord(5) != 0xDEADBEEFu) {
+            mismatch = true;
+        }
+    });
+
+    gpio->setLevelWord(5, 0xDEADBEEFu);
+    gpio->setInputLevel(kFlag, PinLevel::High);
+    visualiser.join();
+
+    EXPECT_FALSE(mismatch.load());
+}
+
+TEST(ConcurrentMockGpioTest, DrivesTrackCircuitFromPlantThread) {
+    auto gpio = std::make_unique<ConcurrentMockGpio>();
+    railway::drivers::TrackCircuitInput::Config cfg;
+    cfg.pin = 2;
+    cfg.debounceMs = 10;
+    railway::drivers::TrackCircuitInput track(cfg, *gpio);
+    track.init();
+
+    std::thread plant([&] { gpio->setInputLevel(2, PinLevel::High); });
+    plant.join();
+
+    track.update(0);
+    track.update(20);
+    EXPECT_FALSE(track.isOccupied());
+}
+
+} // namespace ai_test_section_base
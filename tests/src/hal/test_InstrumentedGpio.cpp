@@ -0,0 +1,153 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/InstrumentedGpio.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include "railway/hal/InstrumentedGpio.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_base {
+
+/* test_InstrumentedGpio.cpp – per-call GPIO latency profiling */
+
+using namespace railway::hal;
+
+class TickClock final : public IClock {
+public:
+    railway::Millis nowMs() const override { return 0; }
+    std::uint64_t nowTicks() const override { return ticks; }
+    std::uint64_t ticksPerSecond() const override { return 1000000000U; }
+
+    std::uint64_t ticks{0};
+};
+
+// Backend whose calls take a configurable number of clock ticks.
+class SlowGpio final : public IGpio {
+public:
+    explicit SlowGpio(TickClock& clock) : clock_(clock) {}
+
+    void configure(Pin pin, PinMode mode) override { backing->configure(pin, mode); }
+    PinLevel read(Pin pin) const override {
+        clock_.ticks += readCost;
+        return backing->read(pin);
+    }
+    void write(Pin pin, PinLevel level) override {
+        clock_.ticks += writeCost;
+        backing->write(pin, level);
+    }
+
+    std::unique_ptr<MockGpio> backing = std::make_unique<MockGpio>();
+    std::uint64_t readCost{10};
+    std::uint64_t writeCost{1000};
+
+private:
+    TickClock& clock_;
+};
+
+const GpioLatencyStats* find(const GpioLatencyStats* stats, std::size_t n, GpioOp op, std::uint16_t key) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (stats[i].op == op && stats[i].key == key) {
+            return &stats[i];
+        }
+    }
+    return nullptr;
+}
+
+TEST(InstrumentedGpioTest, ForwardsEveryCallToTheBackend) {
+    TickClock clock;
+    SlowGpio slow(clock);
+    InstrumentedGpio gpio(slow, clock);
+
+    gpio.configure(4, PinMode::OutputPushPull);
+    gpio.write(4, PinLevel::High);
+    gpio.writeMasked(0, 0x3u, 0x1u);
+    EXPECT_EQ(slow.backing->mode(4), PinMode::OutputPushPull);
+    EXPECT_EQ(gpio.read(4), PinLevel::High);
+    EXPECT_EQ(gpio.read(1), PinLevel::Low);
+    EXPECT_EQ(gpio.readPort(0, 0x13u), 0x11u);
+    EXPECT_EQ(gpio.ticksPerSecond(), 1000000000U);
+}
+
+TEST(InstrumentedGpioTest, RecordsCountsAndLog2HistogramsPerPinAndOperation) {
+    if (!InstrumentedGpio::kEnabled) {
+        GTEST_SKIP() << "GPIO profiling compiled out";
+    }
+    TickClock clock;
+    SlowGpio slow(clock);
+    InstrumentedGpio gpio(slow, clock);
+
+    for (int i = 0; i < 3; ++i) {
+        (void)gpio.read(5);
+    }
+    gpio.write(6, PinLevel::High);
+    slow.readCost = 0;
+    (void)gpio.read(5);
+
+    GpioLatencyStats stats[InstrumentedGpio::kMaxEntries];
+    const std::size_t n = gpio.exportStats(stats, InstrumentedGpio::kMaxEntries);
+    ASSERT_EQ(n, 2u);
+    EXPECT_EQ(gpio.entryCount(), 2u);
+
+    const auto* reads = find(stats, n, GpioOp::Read, 5);
+    ASSERT_NE(reads, nullptr);
+    EXPECT_EQ(reads->calls, 4u);
+    EXPECT_EQ(reads->totalTicks, 30u);
+    EXPECT_EQ(reads->maxTicks, 10u);
+    EXPECT_EQ(reads->buckets[0], 1u); // 0 ticks
+    EXPECT_EQ(reads->buckets[4], 3u); // 10 ticks is in [8, 16)
+
+    const auto* writes = find(stats, n, GpioOp::Write, 6);
+    ASSERT_NE(writes, nullptr);
+    EXPECT_EQ(writes->calls, 1u);
+    EXPECT_EQ(writes->buckets[10], 1u); // 1000 ticks is in [512, 1024)
+}
+
+TEST(InstrumentedGpioTest, PortOperationsAreKeyedByPort) {
+    if (!InstrumentedGpio::kEnabled) {
+        GTEST_SKIP() << "GPIO profiling compiled out";
+    }
+    TickClock clock;
+    SlowGpio slow(clock);
+    InstrumentedGpio gpio(slow, clock);
+
+    // The default writeMasked() falls back to per-pin write() on the backend: 2 pins x 1000.
+    gpio.writeMasked(1, 0x3u, 0x1u);
+    (void)gpio.readPort(1, 0x3u);
+
+    GpioLatencyStats stats[4];
+    const std::size_t n = gpio.exportStats(stats, 4);
+    const auto* masked = find(stats, n, GpioOp::WriteMasked, 1);
+    ASSERT_NE(masked, nullptr);
+    EXPECT_EQ(masked->totalTicks, 2000u);
+    EXPECT_NE(find(stats, n, GpioOp::ReadPort, 1), nullptr);
+    EXPECT_EQ(find(stats, n, GpioOp::Write, 32), nullptr);
+}
+
+TEST(InstrumentedGpioTest, FullTableCountsUntrackedCallsAndResetClears) {
+    if (!InstrumentedGpio::kEnabled) {
+        GTEST_SKIP() << "GPIO profiling compiled out";
+    }
+    TickClock clock;
+    SlowGpio slow(clock);
+    InstrumentedGpio gpio(slow, clock);
+
+    for (Pin pin = 0; pin < InstrumentedGpio::kMaxEntries + 5; ++pin) {
+        (void)gpio.read(pin);
+    }
+    EXPECT_EQ(gpio.entryCount(), InstrumentedGpio::kMaxEntries);
+    EXPECT_EQ(gpio.untrackedCalls(), 5u);
+
+    gpio.reset();
+    GpioLatencyStats stats[1];
+    EXPECT_EQ(gpio.exportStats(stats, 1), 0u);
+    EXPECT_EQ(gpio.entryCount(), 0u);
+    EXPECT_EQ(gpio.untrackedCalls(), 0u);
+}
+
+} // namespace ai_test_section_base
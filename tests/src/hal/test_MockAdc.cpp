@@ -0,0 +1,66 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/MockAdc.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include "railway/hal/MockAdc.h"
+
+namespace ai_test_section_base {
+
+/* test_MockAdc.cpp – injected sample blocks read back in order */
+
+using railway::hal::AdcSample;
+using railway::hal::MockAdc;
+
+TEST(MockAdcTest, ReadsInjectedSamplesInOrderAcrossCalls) {
+    auto adc = std::make_unique<MockAdc>();
+    ASSERT_TRUE(adc->start(2));
+    EXPECT_TRUE(adc->isStarted(2));
+    EXPECT_FALSE(adc->isStarted(3));
+
+    const AdcSample samples[5] = {10, 20, 30, 40, 50};
+    EXPECT_EQ(adc->inject(2, samples, 5), 5u);
+    EXPECT_EQ(adc->pending(2), 5u);
+
+    AdcSample out[3] = {};
+    ASSERT_EQ(adc->read(2, out, 3), 3u);
+    EXPECT_EQ(out[0], 10);
+    EXPECT_EQ(out[2], 30);
+    ASSERT_EQ(adc->read(2, out, 3), 2u);
+    EXPECT_EQ(out[0], 40);
+    EXPECT_EQ(out[1], 50);
+    EXPECT_EQ(adc->read(2, out, 3), 0u);
+}
+
+TEST(MockAdcTest, ChannelsAreIndependent) {
+    auto adc = std::make_unique<MockAdc>();
+    adc->injectConstant(0, 100, 4);
+    adc->injectConstant(1, 200, 2);
+
+    AdcSample out[8] = {};
+    ASSERT_EQ(adc->read(1, out, 8), 2u);
+    EXPECT_EQ(out[0], 200);
+    EXPECT_EQ(adc->pending(0), 4u);
+}
+
+TEST(MockAdcTest, UnreadBufferCountsOverruns) {
+    auto adc = std::make_unique<MockAdc>();
+    EXPECT_EQ(adc->injectConstant(0, 1, MockAdc::kSamplesPerChannel + 10), MockAdc::kSamplesPerChannel);
+    EXPECT_EQ(adc->overruns(0), 10u);
+}
+
+TEST(MockAdcTest, UnknownChannelIsRejected) {
+    auto adc = std::make_unique<MockAdc>();
+    const auto channel = static_cast<railway::hal::AdcChannel>(MockAdc::kChannels);
+    EXPECT_FALSE(adc->start(channel));
+    EXPECT_EQ(adc->injectConstant(channel, 1, 4), 0u);
+    AdcSample out[4] = {};
+    EXPECT_EQ(adc->read(channel, out, 4), 0u);
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,182 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/MockGpio.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_base {
+
+/* test_MockGpio.cpp – bit-packed host GPIO model */
+
+using namespace railway::hal;
+
+class MockGpioTest : public ::testing::Test {
+protected:
+    // Tens of KiB of per-pin state (see MockGpio.h); keep it off the test stack.
+    std::unique_ptr<MockGpio> gpio_ = std::make_unique<MockGpio>();
+};
+
+TEST_F(MockGpioTest, PinsDefaultLowAndInput) {
+    EXPECT_EQ(gpio_->read(0), PinLevel::Low);
+    EXPECT_EQ(gpio_->read(65535), PinLevel::Low);
+    EXPECT_EQ(gpio_->mode(1234), PinMode::Input);
+}
+
+TEST_F(MockGpioTest, CoversFullPinRange) {
+    gpio_->setInputLevel(65535, PinLevel::High);
+    gpio_->write(300, PinLevel::High);
+
+    EXPECT_EQ(gpio_->read(65535), PinLevel::High);
+    EXPECT_EQ(gpio_->read(300), PinLevel::High);
+    EXPECT_EQ(gpio_->read(301), PinLevel::Low);
+    EXPECT_EQ(gpio_->levelWord(MockGpio::kLevelWords - 1), std::uint64_t{1} << 63);
+}
+
+TEST_F(MockGpioTest, ConfigureStoresModePerPinWithoutDisturbingNeighbours) {
+    gpio_->configure(31, PinMode::OutputPushPull);
+    gpio_->configure(32, PinMode::InputPullup);
+
+    EXPECT_EQ(gpio_->mode(30), PinMode::Input);
+    EXPECT_EQ(gpio_->mode(31), PinMode::OutputPushPull);
+    EXPECT_EQ(gpio_->mode(32), PinMode::InputPullup);
+
+    gpio_->configure(31, PinMode::Input);
+    EXPECT_EQ(gpio_->mode(31), PinMode::Input);
+    EXPECT_EQ(gpio_->mode(32), PinMode::InputPullup);
+}
+
+TEST_F(MockGpioTest, WordAccessorsDriveAndToggleSixtyFourPins) {
+    gpio_->setLevelWord(2, 0xF0F0F0F0F0F0F0F0ull);
+    EXPECT_EQ(gpio_->read(128 + 4), PinLevel::High);
+    EXPECT_EQ(gpio_->read(128 + 0), PinLevel::Low);
+
+    gpio_->toggleLevelWord(2, 0xFFull);
+    EXPECT_EQ(gpio_->levelWord(2), 0xF0F0F0F0F0F0F00Full);
+
+    gpio_->setLevelWordMasked(2, 0xFFFF000000000000ull, 0);
+    EXPECT_EQ(gpio_->levelWord(2), 0x0000F0F0F0F0F00Full);
+
+    EXPECT_EQ(gpio_->levelWord(MockGpio::kLevelWords), 0u);
+}
+
+TEST_F(MockGpioTest, PortAccessMapsOntoLevelWords) {
+    gpio_->setLevelWord(1, 0x0000000100000002ull);
+
+    EXPECT_EQ(gpio_->readPort(2, 0xFFFFFFFFu), 0x2u);
+    EXPECT_EQ(gpio_->readPort(3, 0xFFFFFFFFu), 0x1u);
+    EXPECT_EQ(gpio_->readPort(3, 0x2u), 0x0u);
+
+    gpio_->writeMasked(3, 0x3u, 0x2u);
+    EXPECT_EQ(gpio_->read(96), PinLevel::Low);
+    EXPECT_EQ(gpio_->read(97), PinLevel::High);
+    EXPECT_EQ(gpio_->read(65), PinLevel::High);
+}
+
+}  // namespace ai_test_section_base
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/MockGpio.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include "railway/hal/GpioJournal.h"
+#include "railway/hal/MockGpio.h"
+
+namespace ai_test_section_journal {
+
+/* MockGpio write journal */
+
+using namespace railway::hal;
+
+class FixedClock final : public IClock {
+public:
+    railway::Millis now{0};
+    railway::Millis nowMs() const override { return now; }
+};
+
+TEST(MockGpioJournalTest, RecordsWritesWithTimestampButNotInputs) {
+    auto gpio = std::make_unique<MockGpio>();
+    StaticGpioJournal<8> journal;
+    FixedClock clock;
+    clock.now = 42;
+    gpio->setClock(&clock);
+    gpio->attachJournal(&journal);
+
+    gpio->setInputLevel(1, PinLevel::High);
+    gpio->write(7, PinLevel::High);
+    gpio->writeMasked(0, 0x3u, 0x2u);
+
+    GpioWriteRecord rec{};
+    ASSERT_TRUE(journal.pop(rec));
+    EXPECT_EQ(rec.pin, 7u);
+    EXPECT_EQ(rec.level, PinLevel::High);
+    EXPECT_EQ(rec.atMs, 42u);
+    ASSERT_TRUE(journal.pop(rec));
+    EXPECT_EQ(rec.pin, 0u);
+    EXPECT_EQ(rec.level, PinLevel::Low);
+    ASSERT_TRUE(journal.pop(rec));
+    EXPECT_EQ(rec.pin, 1u);
+    EXPECT_EQ(rec.level, PinLevel::High);
+    EXPECT_FALSE(journal.pop(rec));
+}
+
+TEST(MockGpioJournalTest, FullJournalDropsAndCounts) {
+    auto gpio = std::make_unique<MockGpio>();
+    StaticGpioJournal<2> journal;
+    gpio->attachJournal(&journal);
+
+    gpio->write(1, PinLevel::High);
+    gpio->write(2, PinLevel::High);
+    gpio->write(3, PinLevel::High);
+
+    EXPECT_EQ(journal.size(), 2u);
+    EXPECT_EQ(journal.dropped(), 1u);
+    EXPECT_EQ(gpio->read(3), PinLevel::High);
+}
+
+TEST(MockGpioJournalTest, ConsumerThreadSeesWritesInOrder) {
+    constexpr std::size_t kWrites = 20000;
+    auto gpio = std::make_unique<MockGpio>();
+    auto journal = std::make_unique<StaticGpioJournal<256>>();
+    gpio->attachJournal(journal.get());
+
+    std::size_t received = 0;
+    bool ordered = true;
+    std::thread consumer([&] {
+        GpioWriteRecord rec{};
+        while (received < kWrites) {
+            if (journal->pop(rec)) {
+                ordered = ordered && (rec.pin == static_cast<Pin>(received % 1000));
+                ++received;
+            }
+        }
+    });
+
+    for (std::size_t i = 0; i < kWrites; ++i) {
+        while (journal->size() == journal->capacity()) {
+            std::this_thread::yield();
+        }
+        gpio->write(static_cast<Pin>(i % 1000), PinLevel::High);
+    }
+    consumer.join();
+
+    EXPECT_EQ(received, kWrites);
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(journal->dropped(), 0u);
+}
+
+}  // namespace ai_test_section_journal
@@ -0,0 +1,180 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/NoisyGpio.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "railway/drivers/TrackCircuitInput.h"
+#include "railway/hal/MockGpio.h"
+#include "railway/hal/NoisyGpio.h"
+#include "railway/hal/SimulatedClock.h"
+
+namespace ai_test_section_base {
+
+/* test_NoisyGpio.cpp – seeded noise and fault injection */
+
+using namespace railway::hal;
+
+std::vector<PinLevel> record(std::uint64_t seed, int durationMs) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, seed);
+    NoiseProfile profile;
+    profile.bounceMs = 20;
+    profile.glitchMeanIntervalMs = 30;
+    EXPECT_TRUE(noisy.setProfile(2, profile));
+
+    std::vector<PinLevel> levels;
+    for (int t = 0; t < durationMs; ++t) {
+        if (t % 250 == 0) {
+            mock->setInputLevel(2, (t / 250) % 2 == 0 ? PinLevel::High : PinLevel::Low);
+        }
+        levels.push_back(noisy.read(2));
+        clock.advanceMs(1);
+    }
+    return levels;
+}
+
+TEST(NoisyGpioTest, SameSeedReproducesTheSameRun) {
+    EXPECT_EQ(record(42, 5000), record(42, 5000));
+    EXPECT_NE(record(42, 5000), record(43, 5000));
+}
+
+TEST(NoisyGpioTest, PinsWithoutProfilePassThrough) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, 1);
+    mock->setInputLevel(3, PinLevel::High);
+
+    EXPECT_EQ(noisy.read(3), PinLevel::High);
+    noisy.write(10, PinLevel::High);
+    EXPECT_EQ(mock->read(10), PinLevel::High);
+    EXPECT_EQ(noisy.corruptedReads(), 0u);
+}
+
+TEST(NoisyGpioTest, SlowEdgeDelaysVisibleChange) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, 1);
+    NoiseProfile profile;
+    profile.slowEdgeMs = 15;
+    noisy.setProfile(2, profile);
+
+    EXPECT_EQ(noisy.read(2), PinLevel::Low);
+    mock->setInputLevel(2, PinLevel::High);
+    EXPECT_EQ(noisy.read(2), PinLevel::Low);
+    clock.advanceMs(14);
+    EXPECT_EQ(noisy.read(2), PinLevel::Low);
+    clock.advanceMs(1);
+    EXPECT_EQ(noisy.read(2), PinLevel::High);
+    EXPECT_EQ(noisy.corruptedReads(), 2u);
+}
+
+TEST(NoisyGpioTest, BounceSettlesWithinConfiguredWindow) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, 7);
+    NoiseProfile profile;
+    profile.bounceMs = 10;
+    noisy.setProfile(2, profile);
+
+    (void)noisy.read(2);
+    mock->setInputLevel(2, PinLevel::High);
+    for (int t = 0; t < 10; ++t) {
+        (void)noisy.read(2);
+        clock.advanceMs(1);
+    }
+    EXPECT_GT(noisy.corruptedReads(), 0u);
+    for (int t = 0; t < 100; ++t) {
+        EXPECT_EQ(noisy.read(2), PinLevel::High);
+        clock.advanceMs(1);
+    }
+}
+
+TEST(NoisyGpioTest, StuckAtOverridesBackendInsideWindowOnly) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, 1);
+    NoiseProfile profile;
+    profile.stuck = StuckAt::Low;
+    profile.stuckFromMs = 100;
+    profile.stuckUntilMs = 200;
+    noisy.setProfile(2, profile);
+    mock->setInputLevel(2, PinLevel::High);
+
+    EXPECT_EQ(noisy.read(2), PinLevel::High);
+    clock.setUs(100000);
+    EXPECT_EQ(noisy.read(2), PinLevel::Low);
+    EXPECT_EQ(noisy.readPort(0, maskOf(2)), 0u);
+    clock.setUs(200000);
+    EXPECT_EQ(noisy.read(2), PinLevel::High);
+    EXPECT_EQ(noisy.readPort(0, maskOf(2) | maskOf(3)), maskOf(2));
+}
+
+TEST(NoisyGpioTest, ProfileTableIsBounded) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, 1);
+    for (Pin pin = 0; pin < NoisyGpio::kMaxNoisyPins; ++pin) {
+        EXPECT_TRUE(noisy.setProfile(pin, NoiseProfile{}));
+    }
+    EXPECT_FALSE(noisy.setProfile(100, NoiseProfile{}));
+    EXPECT_TRUE(noisy.setProfile(0, NoiseProfile{}));
+    noisy.clearProfile(0);
+    EXPECT_TRUE(noisy.setProfile(100, NoiseProfile{}));
+}
+
+TEST(NoisyGpioTest, ShortGlitchesNeverTripDebounce) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, 2024);
+    NoiseProfile profile;
+    profile.glitchMeanIntervalMs = 20;
+    profile.glitchLengthMs = 5;
+    noisy.setProfile(2, profile);
+    mock->setInputLevel(2, PinLevel::High);
+
+    railway::drivers::BasicTrackCircuitInput<NoisyGpio>::Config cfg;
+    cfg.pin = 2;
+    cfg.debounceMs = 20;
+    railway::drivers::BasicTrackCircuitInput<NoisyGpio> track(cfg, noisy);
+    track.init();
+
+    int falseOccupied = 0;
+    for (int t = 0; t < 60000; ++t) {
+        track.update(clock.nowMs());
+        if (t > 100 && track.isOccupied()) {
+            ++falseOccupied;
+        }
+        clock.advanceMs(1);
+    }
+    EXPECT_GT(noisy.corruptedReads(), 5000u);
+    EXPECT_EQ(falseOccupied, 0);
+}
+
+TEST(NoisyGpioTest, HugeGlitchIntervalIsClampedNotUndefined) {
+    auto mock = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+    NoisyGpio noisy(*mock, clock, 5);
+    mock->setInputLevel(2, PinLevel::High);
+    NoiseProfile profile;
+    // 2 * mean wraps to 0 in 32-bit arithmetic.
+    profile.glitchMeanIntervalMs = 0x80000000u;
+    profile.glitchLengthMs = 0xFFFFFFFFu;
+    ASSERT_TRUE(noisy.setProfile(2, profile));
+
+    // First glitch is at least 1ms away; then reads keep working across a long run.
+    EXPECT_EQ(noisy.read(2), PinLevel::High);
+    for (int i = 0; i < 1000; ++i) {
+        clock.advanceMs(60 * 60 * 1000);
+        noisy.read(2);
+    }
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,107 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/ShadowGpio.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include "railway/drivers/SignalHead.h"
+#include "railway/hal/MockGpio.h"
+#include "railway/hal/ShadowGpio.h"
+
+namespace ai_test_section_base {
+
+/* test_ShadowGpio.cpp – write-coalescing GPIO decorator */
+
+using namespace railway::hal;
+
+// Records the port writes that reach the "bus".
+class BusGpio final : public IGpio {
+public:
+    std::unique_ptr<MockGpio> backing = std::make_unique<MockGpio>();
+    std::vector<std::tuple<Port, PortMask, PortMask>> portWrites;
+
+    void configure(Pin pin, PinMode mode) override { backing->configure(pin, mode); }
+    PinLevel read(Pin pin) const override { return backing->read(pin); }
+    void write(Pin pin, PinLevel level) override { writeMasked(portOf(pin), maskOf(pin), level == PinLevel::High ? maskOf(pin) : 0); }
+    PortMask readPort(Port port, PortMask mask) const override { return backing->readPort(port, mask); }
+    void writeMasked(Port port, PortMask mask, PortMask value) override {
+        portWrites.emplace_back(port, mask, value);
+        backing->writeMasked(port, mask, value);
+    }
+};
+
+TEST(ShadowGpioTest, WritesAreDeferredUntilFlushAndReadBack) {
+    BusGpio bus;
+    ShadowGpio shadow(bus);
+
+    shadow.write(3, PinLevel::High);
+    EXPECT_TRUE(bus.portWrites.empty());
+    EXPECT_EQ(shadow.read(3), PinLevel::High);
+    EXPECT_EQ(shadow.readPort(0, 0xFu), 0x8u);
+    EXPECT_TRUE(shadow.hasPendingWrites());
+
+    EXPECT_EQ(shadow.flush(), 1u);
+    ASSERT_EQ(bus.portWrites.size(), 1u);
+    EXPECT_EQ(bus.backing->read(3), PinLevel::High);
+    EXPECT_FALSE(shadow.hasPendingWrites());
+}
+
+TEST(ShadowGpioTest, SteadyStateSignalProducesNoBusTraffic) {
+    BusGpio bus;
+    ShadowGpio shadow(bus);
+    ::railway::drivers::SignalHead::Config cfg{};
+    cfg.redPin = 10;
+    cfg.yellowPin = 11;
+    cfg.greenPin = 12;
+    ::railway::drivers::SignalHead head(cfg, shadow);
+    head.init();
+    shadow.flush();
+    bus.portWrites.clear();
+
+    for (int tick = 0; tick < 100; ++tick) {
+        head.setAspect(::railway::drivers::Aspect::Stop);
+        shadow.flush();
+    }
+
+    EXPECT_TRUE(bus.portWrites.empty());
+    EXPECT_EQ(shadow.suppressedWrites(), 3u * 100u);
+}
+
+TEST(ShadowGpioTest, ChangesOnOnePortAreBatchedAndRevertsCancel) {
+    BusGpio bus;
+    ShadowGpio shadow(bus);
+    shadow.writeMasked(0, 0x7u, 0x1u);
+    shadow.flush();
+    bus.portWrites.clear();
+
+    shadow.write(0, PinLevel::Low);
+    shadow.write(2, PinLevel::High);
+    shadow.write(5, PinLevel::High);
+    shadow.write(5, PinLevel::Low); // reverted before flush, but 5 was never sent: still flushed once
+    shadow.write(1, PinLevel::High);
+    shadow.write(1, PinLevel::Low); // reverted to the sent level: dropped
+
+    EXPECT_EQ(shadow.flush(), 1u);
+    ASSERT_EQ(bus.portWrites.size(), 1u);
+    EXPECT_EQ(std::get<1>(bus.portWrites[0]), 0x25u);
+    EXPECT_EQ(std::get<2>(bus.portWrites[0]), 0x04u);
+}
+
+TEST(ShadowGpioTest, PinsBeyondShadowedPortsPassThrough) {
+    BusGpio bus;
+    ShadowGpio shadow(bus);
+    const Pin far = static_cast<Pin>(ShadowGpio::kMaxPorts * kPinsPerPort + 1);
+
+    shadow.write(far, PinLevel::High);
+
+    ASSERT_EQ(bus.portWrites.size(), 1u);
+    EXPECT_EQ(bus.backing->read(far), PinLevel::High);
+}
+
+}  // namespace ai_test_section_base
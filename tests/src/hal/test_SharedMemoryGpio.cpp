@@ -0,0 +1,118 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/SharedMemoryGpio.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "railway/hal/SharedMemoryGpio.h"
+
+namespace ai_test_section_base {
+
+/* test_SharedMemoryGpio.cpp – shared-memory GPIO backend */
+
+using namespace railway::hal;
+
+class SharedMemoryGpioTest : public ::testing::Test {
+protected:
+    std::string name_ = "/railway-gpio-test-" + std::to_string(::getpid());
+
+    void TearDown() override {
+        SharedMemoryGpio::remove(name_.c_str());
+    }
+};
+
+TEST_F(SharedMemoryGpioTest, AttachWithoutCreateFailsForMissingSegment) {
+    SharedMemoryGpio gpio;
+    EXPECT_FALSE(gpio.open(name_.c_str(), false));
+    EXPECT_FALSE(gpio.isOpen());
+    EXPECT_EQ(gpio.read(1), PinLevel::Low);
+}
+
+TEST_F(SharedMemoryGpioTest, ControllerAndSimulatorShareOnePinImage) {
+    SharedMemoryGpio simulator;
+    SharedMemoryGpio controller;
+    ASSERT_TRUE(simulator.open(name_.c_str(), true));
+    ASSERT_TRUE(controller.open(name_.c_str(), false));
+
+    // Simulator drives an input, controller samples it.
+    simulator.setInputLevel(40, PinLevel::High);
+    EXPECT_EQ(controller.read(40), PinLevel::High);
+    EXPECT_EQ(controller.readPort(1, 0xFFFFFFFFu), 0x100u);
+
+    // Controller drives outputs, simulator observes them.
+    controller.configure(10, PinMode::OutputPushPull);
+    controller.writeMasked(0, 0x1C00u, 0x0800u);
+    EXPECT_EQ(simulator.mode(10), PinMode::OutputPushPull);
+    EXPECT_EQ(simulator.read(10), PinLevel::Low);
+    EXPECT_EQ(simulator.read(11), PinLevel::High);
+    EXPECT_EQ(simulator.read(12), PinLevel::Low);
+    EXPECT_EQ(simulator.read(40), PinLevel::High);
+}
+
+TEST_F(SharedMemoryGpioTest, ReopeningKeepsExistingState) {
+    {
+        SharedMemoryGpio first;
+        ASSERT_TRUE(first.open(name_.c_str(), true));
+        first.write(65535, PinLevel::High);
+    }
+    SharedMemoryGpio second;
+    ASSERT_TRUE(second.open(name_.c_str(), true));
+    EXPECT_EQ(second.read(65535), PinLevel::High);
+}
+
+TEST_F(SharedMemoryGpioTest, AttachWaitsForCreatorToPublishLayout) {
+    // Creator half-way through open(): segment sized, layout not yet published.
+    const int fd = ::shm_open(name_.c_str(), O_RDWR | O_CREAT, 0660);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(::ftruncate(fd, 1 << 20), 0);
+    void* mem = ::mmap(nullptr, 8, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    ASSERT_NE(mem, MAP_FAILED);
+
+    std::atomic<bool> opened{false};
+    SharedMemoryGpio controller;
+    std::thread attacher([&] { opened = controller.open(name_.c_str(), false); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    // Publish as the creator does: version, then magic ("RGPI").
+    auto* header = static_cast<std::uint32_t*>(mem);
+    header[1] = 1;
+    reinterpret_cast<std::atomic<std::uint32_t>*>(&header[0])->store(0x52475049u);
+    attacher.join();
+    ::munmap(mem, 8);
+
+    EXPECT_TRUE(opened);
+    EXPECT_TRUE(controller.isOpen());
+}
+
+TEST_F(SharedMemoryGpioTest, ConcurrentOpenersAlwaysShareTheSegment) {
+    for (int round = 0; round < 50; ++round) {
+        SharedMemoryGpio::remove(name_.c_str());
+        SharedMemoryGpio a;
+        SharedMemoryGpio b;
+        bool openedA = false;
+        bool openedB = false;
+        std::thread ta([&] { openedA = a.open(name_.c_str(), true); });
+        std::thread tb([&] { openedB = b.open(name_.c_str(), true); });
+        ta.join();
+        tb.join();
+        ASSERT_TRUE(openedA) << round;
+        ASSERT_TRUE(openedB) << round;
+
+        a.setInputLevel(7, PinLevel::High);
+        ASSERT_EQ(b.read(7), PinLevel::High) << round;
+    }
+}
+
+}  // namespace ai_test_section_base
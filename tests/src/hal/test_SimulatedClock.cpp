@@ -0,0 +1,109 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/SimulatedClock.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include "railway/app/BlockController.h"
+#include "railway/app/DemoScenario.h"
+#include "railway/hal/MockGpio.h"
+#include "railway/hal/SimulatedClock.h"
+
+namespace ai_test_section_base {
+
+/* test_SimulatedClock.cpp – explicitly advanced virtual time */
+
+using namespace railway::hal;
+
+TEST(SimulatedClockTest, StartsAtGivenTimeAndOnlyMovesWhenAdvanced) {
+    SimulatedClock clock(1500);
+    EXPECT_EQ(clock.nowUs(), 1500u);
+    EXPECT_EQ(clock.nowMs(), 1u);
+    EXPECT_EQ(clock.nowUs(), 1500u);
+
+    clock.advanceUs(500);
+    EXPECT_EQ(clock.nowMs(), 2u);
+    clock.advanceMs(50);
+    EXPECT_EQ(clock.nowUs(), 52000u);
+    EXPECT_EQ(clock.nowTicks(), 52000u);
+}
+
+TEST(SimulatedClockTest, SetUsNeverMovesBackwards) {
+    SimulatedClock clock;
+    clock.setUs(10000);
+    EXPECT_EQ(clock.nowMs(), 10u);
+    clock.setUs(5000);
+    EXPECT_EQ(clock.nowMs(), 10u);
+}
+
+TEST(SimulatedClockTest, DemoScenarioReachesFaultStopInVirtualTime) {
+    using Controller = railway::app::BasicBlockController<MockGpio, SimulatedClock>;
+    auto gpio = std::make_unique<MockGpio>();
+    SimulatedClock clock;
+
+    Controller::TrackCircuit::Config ownCfg;
+    ownCfg.pin = railway::app::kDemoOwnTrackPin;
+    ownCfg.debounceMs = 50;
+    ownCfg.stuckLowFaultMs = 800;
+    Controller::TrackCircuit own(ownCfg, *gpio);
+    Controller::TrackCircuit::Config nextCfg = ownCfg;
+    nextCfg.pin = railway::app::kDemoDownstreamTrackPin;
+    Controller::TrackCircuit next(nextCfg, *gpio);
+
+    Controller::Signal::Config sigCfg;
+    sigCfg.redPin = railway::app::kDemoRedPin;
+    sigCfg.yellowPin = railway::app::kDemoYellowPin;
+    sigCfg.greenPin = railway::app::kDemoGreenPin;
+    Controller::Signal signal(sigCfg, *gpio);
+
+    Controller controller(Controller::Config{}, clock, own, next, signal);
+    controller.init();
+
+    bool sawClear = false;
+    railway::app::startDemoScenario(*gpio);
+    for (std::uint64_t tMs = 0; tMs < railway::app::kDemoScenarioPeriodMs; tMs += 50) {
+        if (tMs > 0) {
+            railway::app::applyDemoScenario(*gpio, tMs - 50, tMs);
+        }
+        controller.tick();
+        sawClear = sawClear || controller.lastDecision().aspect == railway::drivers::Aspect::Clear;
+        clock.advanceMs(50);
+    }
+
+    EXPECT_TRUE(sawClear);
+    EXPECT_EQ(controller.lastDecision().aspect, railway::drivers::Aspect::Stop);
+    EXPECT_EQ(controller.lastDecision().reason, railway::logic::StopReason::TrackCircuitFault);
+    EXPECT_EQ(clock.nowMs(), static_cast<railway::Millis>(railway::app::kDemoScenarioPeriodMs));
+}
+
+TEST(SimulatedClockTest, DemoScenarioFiresEveryChangeWhateverTheTick) {
+    // 70ms divides none of the change times; compare against 1ms steps over two periods.
+    auto coarse = std::make_unique<MockGpio>();
+    auto fine = std::make_unique<MockGpio>();
+    railway::app::startDemoScenario(*coarse);
+    railway::app::startDemoScenario(*fine);
+
+    std::uint64_t fineMs = 0;
+    for (std::uint64_t tMs = 70; tMs < 2 * railway::app::kDemoScenarioPeriodMs; tMs += 70) {
+        railway::app::applyDemoScenario(*coarse, tMs - 70, tMs);
+        for (; fineMs < tMs; ++fineMs) {
+            railway::app::applyDemoScenario(*fine, fineMs, fineMs + 1);
+        }
+        EXPECT_EQ(coarse->read(railway::app::kDemoOwnTrackPin), fine->read(railway::app::kDemoOwnTrackPin)) << tMs;
+        EXPECT_EQ(coarse->read(railway::app::kDemoDownstreamTrackPin),
+                  fine->read(railway::app::kDemoDownstreamTrackPin))
+            << tMs;
+    }
+
+    // The 0ms changes fire again when a span crosses into the next period.
+    railway::app::applyDemoScenario(*coarse, 3950, 4020);
+    EXPECT_EQ(coarse->read(railway::app::kDemoOwnTrackPin), PinLevel::High);
+    EXPECT_EQ(coarse->read(railway::app::kDemoDownstreamTrackPin), PinLevel::High);
+}
+
+} // namespace ai_test_section_base
@@ -0,0 +1,67 @@
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/hal/ThreadSleeper.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "railway/hal/SimulatedClock.h"
+#include "railway/hal/SimulatedSleeper.h"
+#include "railway/hal/SteadyClock.h"
+#include "railway/hal/ThreadSleeper.h"
+
+namespace ai_test_section_base {
+
+/* test_ThreadSleeper.cpp – host and virtual-time sleepers */
+
+using namespace railway::hal;
+
+TEST(ThreadSleeperTest, SleepsUntilDeadline) {
+    SteadyClock clock;
+    ThreadSleeper sleeper(clock);
+    const auto start = clock.nowMs();
+    sleeper.sleepUntilMs(start + 20);
+    EXPECT_GE(clock.nowMs() - start, 20u);
+}
+
+TEST(ThreadSleeperTest, WakeFromAnotherThreadEndsSleepEarly) {
+    SteadyClock clock;
+    ThreadSleeper sleeper(clock);
+    const auto start = clock.nowMs();
+    std::thread waker([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        sleeper.wake();
+    });
+    sleeper.sleepUntilMs(start + 10000);
+    waker.join();
+    EXPECT_LT(clock.nowMs() - start, 5000u);
+}
+
+TEST(ThreadSleeperTest, PendingWakeMakesNextSleepReturnImmediately) {
+    SteadyClock clock;
+    ThreadSleeper sleeper(clock);
+    sleeper.wake();
+    const auto start = clock.nowMs();
+    sleeper.sleepUntilMs(start + 10000);
+    EXPECT_LT(clock.nowMs() - start, 5000u);
+}
+
+TEST(SimulatedSleeperTest, AdvancesVirtualTimeUnlessWoken) {
+    SimulatedClock clock;
+    SimulatedSleeper sleeper(clock);
+    sleeper.sleepUntilMs(250);
+    EXPECT_EQ(clock.nowMs(), 250u);
+    sleeper.sleepUntilMs(100);
+    EXPECT_EQ(clock.nowMs(), 250u);
+    sleeper.wake();
+    sleeper.sleepUntilMs(1000);
+    EXPECT_EQ(clock.nowMs(), 250u);
+    sleeper.sleepUntilMs(1000);
+    EXPECT_EQ(clock.nowMs(), 1000u);
+}
+
+} // namespace ai_test_section_base
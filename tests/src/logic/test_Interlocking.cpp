@@ -106,3 +106,61 @@ TEST_F(InterlockingTest, AllClearReturnsClear) {
 // Skipped due to hardware dependency: None
 
 }  // namespace ai_test_section_base
+
+/* AI-TEST-SECTION
+Section: BASE_TESTS
+Source: src/logic/Interlocking.cpp
+Status: Pending Review
+Approved: false
+Reviewed-By:
+Reviewed-At:
+*/
+#include <gtest/gtest.h>
+#include "railway/logic/Interlocking.h"
+
+namespace ai_test_section_lamp_proving {
+
+/* applyLampProving */
+
+using railway::drivers::Aspect;
+using railway::logic::Decision;
+using railway::logic::StopReason;
+
+Decision clear() {
+    railway::logic::Inputs in{};
+    in.controllerFresh = true;
+    in.ownTrackCircuitHealthy = true;
+    in.ownBlockOccupied = false;
+    in.downstreamBlockOccupied = false;
+    return railway::logic::evaluate(in);
+}
+
+TEST(ApplyLampProvingTest, ProvenDecisionIsUnchanged) {
+    const Decision out = railway::logic::applyLampProving(clear(), true);
+    EXPECT_EQ(out.aspect, Aspect::Clear);
+    EXPECT_EQ(out.reason, StopReason::None);
+    EXPECT_EQ(out.health, railway::Health::Ok);
+}
+
+TEST(ApplyLampProvingTest, LampFailureForcesStopAndDegrades) {
+    const Decision out = railway::logic::applyLampProving(clear(), false);
+    EXPECT_EQ(out.aspect, Aspect::Stop);
+    EXPECT_EQ(out.reason, StopReason::LampFailure);
+    EXPECT_EQ(out.health, railway::Health::Degraded);
+}
+
+TEST(ApplyLampProvingTest, FaultHealthAndStaleReasonAreKept) {
+    Decision stale{};
+    Decision out = railway::logic::applyLampProving(stale, false);
+    EXPECT_EQ(out.reason, StopReason::ControllerStale);
+    EXPECT_EQ(out.health, railway::Health::Fault);
+
+    Decision trackFault{};
+    trackFault.reason = StopReason::TrackCircuitFault;
+    trackFault.health = railway::Health::Fault;
+    out = railway::logic::applyLampProving(trackFault, false);
+    EXPECT_EQ(out.reason, StopReason::LampFailure);
+    EXPECT_EQ(out.health, railway::Health::Fault);
+}
+
+}  // namespace ai_test_section_lamp_proving
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace railway::test {
+
+// Small deterministic generator for randomised differential tests; a given seed always
+// produces the same sequence on every platform.
+struct Lcg {
+    std::uint32_t state;
+    // Uniform-enough value in [0, bound).
+    std::uint32_t next(std::uint32_t bound) {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) % bound;
+    }
+};
+
+} // namespace railway::test